@@ -0,0 +1,303 @@
+// ----- << External Library >> ----- //
+#include "BackingStore.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// ----- << Static Functions >> ----- //
+static inline std::string byteToHex(uint8_t byte)
+{
+	static const char digits[] = "0123456789ABCDEF";
+
+	return { digits[byte >> 4], digits[byte & 0x0F] };
+}
+
+// ----- << Private Member Function Implementation >> ----- //
+void BackingStore::growMapping(size_t bytes)
+{
+	if (bytes <= mappedSize)
+	{
+		return;
+	}
+
+	// Double the mapping, in whole chunks, so remaps stay rare
+	size_t newSize = std::max(bytes, mappedSize * 2);
+	newSize = (newSize + growthChunk - 1) / growthChunk * growthChunk;
+
+#ifdef _WIN32
+	if (mapping)
+	{
+		FlushViewOfFile(mapping, 0);
+		UnmapViewOfFile(mapping);
+		CloseHandle(mappingHandle);
+	}
+
+	// Creating a larger mapping object extends the file
+	mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READWRITE,
+		static_cast<DWORD>(static_cast<uint64_t>(newSize) >> 32), static_cast<DWORD>(newSize & 0xFFFFFFFF), nullptr);
+
+	if (!mappingHandle)
+	{
+		throw std::runtime_error("\nERROR: Cannot create the backing store mapping\n");
+	}
+
+	mapping = static_cast<uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, newSize));
+
+	if (!mapping)
+	{
+		throw std::runtime_error("\nERROR: Cannot map the backing store\n");
+	}
+#else
+	if (mapping)
+	{
+		munmap(mapping, mappedSize);
+	}
+
+	if (ftruncate(fileDescriptor, static_cast<off_t>(newSize)) != 0)
+	{
+		throw std::runtime_error("\nERROR: Cannot grow the backing store\n");
+	}
+
+	void* address = mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+
+	if (address == MAP_FAILED)
+	{
+		mapping = nullptr;
+		throw std::runtime_error("\nERROR: Cannot map the backing store\n");
+	}
+
+	mapping = static_cast<uint8_t*>(address);
+#endif
+
+	mappedSize = newSize;
+}
+
+void BackingStore::readSlot(unsigned long long ID, uint8_t* buffer)
+{
+	if (mapped)
+	{
+		std::memcpy(buffer, mapping + ID * frameSize, frameSize);
+		return;
+	}
+
+	file.seekg(static_cast<std::streamoff>(ID * frameSize));
+	file.read(reinterpret_cast<char*>(buffer), frameSize);
+
+	if (!file)
+	{
+		file.clear();
+		throw std::runtime_error("\nERROR: Backing store read failed\n");
+	}
+}
+
+void BackingStore::writeSlot(unsigned long long ID, const uint8_t* data)
+{
+	if (mapped)
+	{
+		growMapping((ID + 1) * frameSize);
+		std::memcpy(mapping + ID * frameSize, data, frameSize);
+		return;
+	}
+
+	file.seekp(static_cast<std::streamoff>(ID * frameSize));
+	file.write(reinterpret_cast<const char*>(data), frameSize);
+
+	if (!file)
+	{
+		file.clear();
+		throw std::runtime_error("\nERROR: Backing store write failed\n");
+	}
+}
+
+// ----- << Public Member Function Implementation >> ----- //
+BackingStore::BackingStore(size_t frameSize, std::string path, std::string mode)
+	: mapped(mode == "MMAP"), frameSize(frameSize), mappedSize(0), mapping(nullptr), path(path)
+{
+#ifdef _WIN32
+	fileHandle = INVALID_HANDLE_VALUE;
+	mappingHandle = nullptr;
+#else
+	fileDescriptor = -1;
+#endif
+
+	if (!mapped)
+	{
+		file.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (!file.is_open())
+		{
+			std::cerr << "ERROR: Cannot open " << path << " for the backing store\n\n";
+			throw std::runtime_error("Error: Cannot open " + path + " for the backing store\n");
+		}
+
+		return;
+	}
+
+#ifdef _WIN32
+	fileHandle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+		CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (fileHandle == INVALID_HANDLE_VALUE)
+#else
+	fileDescriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+	if (fileDescriptor < 0)
+#endif
+	{
+		std::cerr << "ERROR: Cannot open " << path << " for the backing store\n\n";
+		throw std::runtime_error("Error: Cannot open " + path + " for the backing store\n");
+	}
+
+	growMapping(growthChunk);
+}
+
+BackingStore::~BackingStore()
+{
+	if (!mapped)
+	{
+		file.close();
+		return;
+	}
+
+#ifdef _WIN32
+	if (mapping)
+	{
+		UnmapViewOfFile(mapping);
+	}
+
+	if (mappingHandle)
+	{
+		CloseHandle(mappingHandle);
+	}
+
+	if (fileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(fileHandle);
+	}
+#else
+	if (mapping)
+	{
+		munmap(mapping, mappedSize);
+	}
+
+	if (fileDescriptor >= 0)
+	{
+		close(fileDescriptor);
+	}
+#endif
+}
+
+bool BackingStore::contains(unsigned long long ID)
+{
+	std::unique_lock<std::mutex> fileLock(fileMutex);
+
+	return ID < written.size() && written[ID];
+}
+
+size_t BackingStore::exportText(const std::string& exportPath)
+{
+	std::unique_lock<std::mutex> fileLock(fileMutex);
+
+	std::ofstream output(exportPath, std::ios::trunc);
+
+	if (!output)
+	{
+		throw std::runtime_error("Error: Cannot open " + exportPath + " for export\n");
+	}
+
+	std::vector<uint8_t> buffer(frameSize);
+	size_t exported = 0;
+
+	for (unsigned long long ID = 0; ID < written.size(); ID++)
+	{
+		if (!written[ID])
+		{
+			continue;
+		}
+
+		readSlot(ID, buffer.data());
+
+		output << ID << " ";
+		for (uint8_t byte : buffer)
+		{
+			output << byteToHex(byte);
+		}
+		output << "\n";
+
+		exported++;
+	}
+
+	return exported;
+}
+
+bool BackingStore::read(unsigned long long ID, uint8_t* buffer)
+{
+	std::unique_lock<std::mutex> fileLock(fileMutex);
+
+	if (ID >= written.size() || !written[ID])
+	{
+		return false;
+	}
+
+	readSlot(ID, buffer);
+	return true;
+}
+
+void BackingStore::readRange(unsigned long long firstID, size_t count, uint8_t* buffer)
+{
+	std::unique_lock<std::mutex> fileLock(fileMutex);
+
+	size_t offset = firstID * frameSize;
+	size_t bytes = count * frameSize;
+	size_t available = 0;
+
+	if (mapped)
+	{
+		available = offset < mappedSize ? std::min(bytes, mappedSize - offset) : 0;
+		std::memcpy(buffer, mapping + offset, available);
+	}
+	else
+	{
+		file.seekg(static_cast<std::streamoff>(offset));
+		file.read(reinterpret_cast<char*>(buffer), bytes);
+
+		available = static_cast<size_t>(file.gcount());
+		file.clear();
+	}
+
+	std::memset(buffer + available, 0, bytes - available);
+}
+
+void BackingStore::reserve(unsigned long long frameCount)
+{
+	std::unique_lock<std::mutex> fileLock(fileMutex);
+
+	if (mapped)
+	{
+		growMapping(frameCount * frameSize);
+	}
+}
+
+void BackingStore::write(unsigned long long ID, const uint8_t* data)
+{
+	std::unique_lock<std::mutex> fileLock(fileMutex);
+
+	writeSlot(ID, data);
+
+	if (ID >= written.size())
+	{
+		written.resize(ID + 1, 0);
+	}
+
+	written[ID] = 1;
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ----- << Class >> ----- //
+/**
+ * @brief	A class that emulates the backing store as a binary file
+ *			of fixed-size slots, where the slot of a frame is at
+ *			frame ID * frame size
+ * 
+ *			FILE mode keeps the file open for the lifetime of the 
+ *			object so a page in or page out is one seek and one 
+ *			frame-sized read or write
+ * 
+ *			MMAP mode maps the file into memory so a page in or
+ *			page out is a memcpy, and the operating system's page
+ *			cache does the buffering. The mapping grows in chunks
+ */
+class BackingStore
+{
+private:
+	// Primitive Data Members
+	bool mapped;
+	size_t frameSize;
+	size_t mappedSize;
+
+	uint8_t* mapping;
+			// Start of the mapped file (MMAP only)
+
+#ifdef _WIN32
+	void* fileHandle;
+	void* mappingHandle;
+#else
+	int fileDescriptor;
+#endif
+
+	static constexpr size_t growthChunk = static_cast<size_t>(1) << 20;
+
+	// User-defined Data Members
+	std::mutex fileMutex;
+
+	std::string path;
+
+	std::fstream file;
+			// FILE only
+
+	std::vector<uint8_t> written;
+			// Indexed by frame ID, set once the slot holds data
+
+	/**
+	 * @brief	Grows the file and the mapping so that it covers
+	 *			at least the given number of bytes
+	 * 
+	 *			WARNING: Caller must hold fileMutex
+	 * 
+	 * @param	bytes --
+	 *			Minimum size of the mapping
+	 */
+	void growMapping(size_t bytes);
+
+	/**
+	 * @brief	Copies a slot into a buffer
+	 * 
+	 *			WARNING: Caller must hold fileMutex
+	 */
+	void readSlot(unsigned long long ID, uint8_t* buffer);
+
+	/**
+	 * @brief	Copies a buffer into a slot
+	 * 
+	 *			WARNING: Caller must hold fileMutex
+	 */
+	void writeSlot(unsigned long long ID, const uint8_t* data);
+
+public:
+	/**
+	 * @brief	Class constructor
+	 * 
+	 * @param	frameSize --
+	 *			The number of bytes in every slot
+	 * 
+	 * @param	path --
+	 *			The file that holds the slots, truncated on open
+	 * 
+	 * @param	mode --
+	 *			"FILE" for positioned stream I/O or "MMAP" for a
+	 *			memory-mapped file
+	 */
+	BackingStore(size_t frameSize, std::string path, std::string mode);
+
+	/**
+	 * @brief	Class destructor
+	 */
+	~BackingStore();
+
+	/**
+	 * @brief	Checks if a frame has been written to the backing
+	 *			store
+	 * 
+	 * @param	ID --
+	 *			The unique ID that identifies a frame
+	 * 
+	 * @return	true if the slot of the frame holds data.
+	 *			Otherwise, false.
+	 */
+	bool contains(unsigned long long ID);
+
+	/**
+	 * @brief	Writes every stored frame as a "ID HEXDATA" line,
+	 *			in ID order, for debugging
+	 * 
+	 * @param	exportPath --
+	 *			The text file that is written
+	 * 
+	 * @return	The number of frames written
+	 */
+	size_t exportText(const std::string& exportPath);
+
+	/**
+	 * @brief	Reads a frame from its slot
+	 * 
+	 * @param	ID --
+	 *			The unique ID that identifies a frame
+	 * 
+	 * @param	buffer --
+	 *			Destination of frameSize bytes
+	 * 
+	 * @return	true if the frame was read. false if the frame was
+	 *			never written
+	 */
+	bool read(unsigned long long ID, uint8_t* buffer);
+
+	/**
+	 * @brief	Reads the slots of consecutive frames in a single
+	 *			read. Slots past the end of the file read as zeros
+	 * 
+	 * @param	firstID --
+	 *			The unique ID of the first frame
+	 * 
+	 * @param	count --
+	 *			The number of frames read
+	 * 
+	 * @param	buffer --
+	 *			Destination of count * frameSize bytes
+	 */
+	void readRange(unsigned long long firstID, size_t count, uint8_t* buffer);
+
+	/**
+	 * @brief	Makes room for frames up to the given ID so that
+	 *			later writes do not grow the mapping one slot at a
+	 *			time. Does nothing in FILE mode
+	 * 
+	 * @param	frameCount --
+	 *			Number of frame IDs, starting from 0, to make room 
+	 *			for
+	 */
+	void reserve(unsigned long long frameCount);
+
+	/**
+	 * @brief	Writes a frame to its slot
+	 * 
+	 * @param	ID --
+	 *			The unique ID that identifies a frame
+	 * 
+	 * @param	data --
+	 *			Source of frameSize bytes
+	 */
+	void write(unsigned long long ID, const uint8_t* data);
+};
\ No newline at end of file
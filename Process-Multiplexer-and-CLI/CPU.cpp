@@ -21,10 +21,18 @@
 #include "Instruction_SUBTRACT.hpp"
 #include "Instruction_WRITE.hpp"
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <iomanip>
+#include <map>
 #include <random>
 #include <sstream>
+#include <unordered_map>
+
+// Scratch backing store of the benchmarks, so they never truncate the
+// backing store of the running system
+static const char* const benchmarkStorePath = "benchmark-store.bin";
 
 // ----- << Randomizer Functions >> ----- //
 static std::string randomIdentifier()
@@ -134,6 +142,27 @@ static std::vector<std::string> splitTopLevel(const std::string& string)
 	return result;
 }
 
+static std::optional<uint32_t> parseHexAddress(const std::string& string)
+{
+	unsigned long long address = 0;
+
+	try
+	{
+		address = std::stoull(string, nullptr, 16);
+	}
+	catch (const std::exception&)
+	{
+		return std::nullopt;
+	}
+
+	if (address > UINT32_MAX)
+	{
+		return std::nullopt;
+	}
+
+	return static_cast<uint32_t>(address);
+}
+
 static std::string centerString(const std::string& string, size_t width)
 {
 	if (string.size() >= width)
@@ -147,6 +176,389 @@ static std::string centerString(const std::string& string, size_t width)
 
 	return std::string(lPadding, ' ') + string + std::string(rPadding, ' ');
 }
+
+// ----- << Self-Check Functions >> ----- //
+static bool reportCheck(const std::string& name, bool passed)
+{
+	std::cout << std::left << std::setw(40) << name << (passed ? "PASS" : "FAIL") << "\n";
+
+	return passed;
+}
+
+static bool checkVictimOrder()
+{
+	// Hits call touch, misses evict once the 4 slots are full. The 
+	// expected victims were worked out by hand from each policy's 
+	// rules, and no two policies agree on this trace
+	const size_t numFrames = 4;
+	const std::vector<unsigned long long> trace = { 1, 2, 1, 3, 4, 5, 3, 1, 2, 6, 3, 5 };
+	const std::vector<std::pair<const char*, std::vector<unsigned long long>>> expected = {
+		{ "LRU",	{ 2, 4, 5, 1 } },
+		{ "CLOCK",	{ 1, 2, 4, 3, 5, 1 } },
+		{ "FIFO",	{ 1, 2, 3, 4, 5, 1 } },
+		{ "LFU",	{ 2, 4, 5, 2 } },
+		{ "ARC",	{ 2, 4, 3, 5, 6 } },
+		{ "2Q",		{ 1, 2, 3, 4, 5, 6 } }
+	};
+
+	bool passed = true;
+
+	for (const auto& [name, victims] : expected)
+	{
+		std::unique_ptr<ReplacementPolicy> policy = ReplacementPolicy::create(name, numFrames);
+		std::unordered_map<unsigned long long, size_t> resident;
+		std::vector<unsigned long long> slotFrame(numFrames, 0);
+		std::vector<unsigned long long> evicted;
+		size_t nextFree = 0;
+
+		for (unsigned long long frameID : trace)
+		{
+			auto slot = resident.find(frameID);
+
+			if (slot != resident.end())
+			{
+				policy->touch(slot->second);
+				continue;
+			}
+
+			size_t victim;
+
+			if (nextFree < numFrames)
+			{
+				victim = nextFree++;
+			}
+			else
+			{
+				victim = *policy->evict();
+				evicted.push_back(slotFrame[victim]);
+				resident.erase(slotFrame[victim]);
+			}
+
+			slotFrame[victim] = frameID;
+			resident[frameID] = victim;
+			policy->admit(victim, frameID);
+		}
+
+		passed = reportCheck(std::string(name) + " victim order", evicted == victims) && passed;
+	}
+
+	return passed;
+}
+
+static bool checkCompressedRoundTrip()
+{
+	// The pool only fits part of the frames, so some are read back
+	// from the pool, some after a spill, and incompressible ones
+	// straight from the backing store
+	const size_t frameSize = 256;
+	const size_t numFrames = 64;
+	const size_t poolCapacity = 4096;
+
+	std::mt19937 gen(7);
+	std::uniform_int_distribution<int> byteDist(0, 255);
+	std::vector<std::vector<uint8_t>> frames(numFrames, std::vector<uint8_t>(frameSize, 0));
+
+	auto fill = [&](std::vector<uint8_t>& frame, size_t pattern)
+	{
+		std::fill(frame.begin(), frame.end(), 0);
+
+		for (size_t i = 0; i < frameSize; i++)
+		{
+			if (pattern % 4 == 1 && i % 37 < 3)			frame[i] = static_cast<uint8_t>(byteDist(gen) | 1);
+			else if (pattern % 4 == 2)					frame[i] = static_cast<uint8_t>(byteDist(gen));
+			else if (pattern % 4 == 3 && i >= 200)		frame[i] = static_cast<uint8_t>(i);
+		}
+	};
+
+	bool passed;
+
+	{
+		BackingStore backingStore(frameSize, benchmarkStorePath, "FILE");
+		CompressedSwap swap(frameSize, poolCapacity, backingStore);
+		std::vector<uint8_t> buffer(numFrames * frameSize);
+
+		for (size_t i = 0; i < numFrames; i++)
+		{
+			fill(frames[i], i);
+			swap.write(i, frames[i].data());
+		}
+
+		// Rewritten frames must not read back their older copy
+		for (size_t i = 0; i < numFrames; i += 3)
+		{
+			fill(frames[i], i + 1);
+			swap.write(i, frames[i].data());
+		}
+
+		bool readsMatch = true;
+
+		for (size_t i = 0; i < numFrames; i++)
+		{
+			readsMatch = swap.read(i, buffer.data()) && std::equal(frames[i].begin(), frames[i].end(), buffer.begin()) && readsMatch;
+		}
+
+		swap.readRange(0, numFrames, buffer.data());
+
+		bool rangeMatches = true;
+
+		for (size_t i = 0; i < numFrames; i++)
+		{
+			rangeMatches = std::equal(frames[i].begin(), frames[i].end(), buffer.begin() + i * frameSize) && rangeMatches;
+		}
+
+		passed = reportCheck("Compressed pool read", readsMatch);
+		passed = reportCheck("Compressed pool read range", rangeMatches) && passed;
+		passed = reportCheck("Compressed pool spills and hits", swap.getSpills() > 0 && swap.getPoolHits() > 0) && passed;
+	}
+
+	std::remove(benchmarkStorePath);
+
+	return passed;
+}
+
+static bool checkPageMerging()
+{
+	// Two processes that only read their pages hold identical clean
+	// zero frames, which the merger shares. A write must then copy
+	// the frame for the writer only
+	const size_t processMemory = 256;
+	const std::chrono::milliseconds mergeTimeout(2000);
+
+	bool passed;
+
+	{
+		bool checkBreaker = false;
+		MMU checkMMU(10, 12, 4, 6, "LRU", "FILE", benchmarkStorePath, 0, 0, 0, checkBreaker);
+
+		for (unsigned long long processID = 1; processID <= 2; processID++)
+		{
+			checkMMU.createPages(processID, processMemory);
+
+			for (uint32_t address = 0; address < processMemory; address += 2)
+			{
+				checkMMU.protectedRead(processID, address);
+			}
+		}
+
+		auto deadline = std::chrono::steady_clock::now() + mergeTimeout;
+
+		while (checkMMU.getMergedPages() == 0 && std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+
+		bool merged = checkMMU.getMergedPages() > 0;
+		bool written = checkMMU.protectedWrite(1, 0, 0xBEEF);
+		std::optional<uint16_t> writer = checkMMU.protectedRead(1, 0);
+		std::optional<uint16_t> sharer = checkMMU.protectedRead(2, 0);
+
+		passed = reportCheck("Page merging shares zero frames", merged);
+		passed = reportCheck("Page merging copy-on-write", merged && written && checkMMU.getCopyOnWrites() > 0
+			&& writer == static_cast<uint16_t>(0xBEEF) && sharer == static_cast<uint16_t>(0)) && passed;
+	}
+
+	std::remove(benchmarkStorePath);
+
+	return passed;
+}
+
+static bool checkForkIsolation()
+{
+	// The child starts with the parent's values. Afterwards each one
+	// writes its own half, and neither may see the other's writes,
+	// also once the parent is gone
+	const size_t processMemory = 256;
+	const size_t words = processMemory / 2;
+
+	bool passed;
+
+	{
+		bool checkBreaker = false;
+		MMU checkMMU(10, 12, 4, 6, "LRU", "FILE", benchmarkStorePath, 0, 0, 0, checkBreaker);
+		std::vector<uint16_t> parentValues(words);
+
+		checkMMU.createPages(1, processMemory);
+
+		for (size_t i = 0; i < words; i++)
+		{
+			parentValues[i] = static_cast<uint16_t>(i * 37 + 1);
+			checkMMU.protectedWrite(1, static_cast<uint32_t>(i * 2), parentValues[i]);
+		}
+
+		bool forked = checkMMU.forkPages(1, 2);
+		bool inherited = forked;
+
+		for (size_t i = 0; i < words && forked; i++)
+		{
+			inherited = checkMMU.protectedRead(2, static_cast<uint32_t>(i * 2)) == parentValues[i] && inherited;
+		}
+
+		std::vector<uint16_t> childValues = parentValues;
+
+		for (size_t i = 0; i < words && forked; i++)
+		{
+			if (i < words / 2)
+			{
+				childValues[i] = static_cast<uint16_t>(0xC000 + i);
+				checkMMU.protectedWrite(2, static_cast<uint32_t>(i * 2), childValues[i]);
+			}
+			else
+			{
+				parentValues[i] = static_cast<uint16_t>(0xA000 + i);
+				checkMMU.protectedWrite(1, static_cast<uint32_t>(i * 2), parentValues[i]);
+			}
+		}
+
+		bool isolated = forked && checkMMU.getCopyOnWrites() > 0;
+
+		for (size_t i = 0; i < words && forked; i++)
+		{
+			isolated = checkMMU.protectedRead(1, static_cast<uint32_t>(i * 2)) == parentValues[i]
+				&& checkMMU.protectedRead(2, static_cast<uint32_t>(i * 2)) == childValues[i] && isolated;
+		}
+
+		checkMMU.remove(1);
+
+		bool outlives = forked;
+
+		for (size_t i = 0; i < words && forked; i++)
+		{
+			outlives = checkMMU.protectedRead(2, static_cast<uint32_t>(i * 2)) == childValues[i] && outlives;
+		}
+
+		passed = reportCheck("Fork inherits the parent's values", inherited);
+		passed = reportCheck("Fork isolates parent and child writes", isolated) && passed;
+		passed = reportCheck("Fork child outlives its parent", outlives) && passed;
+	}
+
+	std::remove(benchmarkStorePath);
+
+	return passed;
+}
+
+static bool checkDataSection()
+{
+	// The reference is the std::map the data section used to be,
+	// with its linear scans. Identifiers already in it are not
+	// inserted again, since every caller checks for them first
+	const size_t numberOfVariables = 32;
+	const size_t numberOfIdentifiers = 48;
+	const size_t operations = 20000;
+
+	std::map<std::string, std::optional<std::pair<std::string, uint16_t>>> reference;
+
+	for (size_t i = 0; i < numberOfVariables; i++)
+	{
+		std::ostringstream stream;
+		stream << std::hex << std::uppercase
+			<< std::setw(5) << std::setfill('0') << (i * 2);
+
+		reference[stream.str()] = std::nullopt;
+	}
+
+	auto referenceFind = [&](const std::string& identifier)
+	{
+		for (auto entry = reference.begin(); entry != reference.end(); entry++)
+		{
+			if (entry->second && entry->second->first == identifier)
+			{
+				return entry;
+			}
+		}
+
+		return reference.end();
+	};
+
+	auto referenceFull = [&]()
+	{
+		for (const auto& [address, variable] : reference)
+		{
+			if (!variable)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	std::mt19937 gen(25);
+	std::uniform_int_distribution<size_t> identifierDist(0, numberOfIdentifiers - 1);
+	std::uniform_int_distribution<int> operationDist(0, 3);
+	std::uniform_int_distribution<int> valueDist(0, 65535);
+
+	LogicalDataSection dataSection(numberOfVariables);
+	bool matches = true;
+
+	for (size_t i = 0; i < operations && matches; i++)
+	{
+		std::string identifier = "v" + std::to_string(identifierDist(gen));
+		auto expected = referenceFind(identifier);
+		bool found = expected != reference.end();
+
+		switch (operationDist(gen))
+		{
+		case 0:
+		{
+			bool inserted = found;
+
+			if (!found && !referenceFull())
+			{
+				for (auto& [address, variable] : reference)
+				{
+					if (!variable)
+					{
+						variable = { identifier, 0 };
+						inserted = true;
+						break;
+					}
+				}
+			}
+
+			matches = dataSection.insertVariable(identifier) == inserted;
+			break;
+		}
+		case 1:
+		{
+			uint16_t value = static_cast<uint16_t>(valueDist(gen));
+
+			if (found)
+			{
+				expected->second->second = value;
+			}
+
+			matches = dataSection.setValue(identifier, value) == found;
+			break;
+		}
+		case 2:
+			matches = dataSection.getData(identifier) == (found ? std::optional<uint16_t>(expected->second->second) : std::nullopt);
+			break;
+		default:
+			matches = dataSection.getVariableAddress(identifier) == (found ? std::optional<std::string>(expected->first) : std::nullopt)
+				&& dataSection.contains(identifier) == found;
+			break;
+		}
+
+		matches = matches && dataSection.isFull() == referenceFull();
+	}
+
+	// A forked process starts with a copy of the data section
+	LogicalDataSection copy(dataSection);
+	bool copyMatches = matches;
+
+	for (size_t i = 0; i < numberOfIdentifiers && copyMatches; i++)
+	{
+		std::string identifier = "v" + std::to_string(i);
+		auto expected = referenceFind(identifier);
+
+		copyMatches = copy.getData(identifier) == (expected != reference.end() ? std::optional<uint16_t>(expected->second->second) : std::nullopt);
+	}
+
+	bool passed = reportCheck("Data section matches the old map", matches);
+	passed = reportCheck("Data section copy matches", copyMatches) && passed;
+
+	return passed;
+}
 // ----- << Private Member Function Implementation >> ------ //
 void CPU::createProcess(std::string name, size_t heapSize, std::vector<std::unique_ptr<Instruction>>&& instructions, size_t priority, size_t memoryRequired)
 {
@@ -160,12 +572,12 @@ void CPU::createProcess(std::string name, size_t heapSize, std::vector<std::uniq
 	auto processControlBlock = std::make_shared<PCB>(ID, heapSize, std::move(instructions), priority, memoryRequired);
 	processControlBlock->setName(name);
 	
-	cores[processControlBlock->getProcessID() % cores.size()]->assign(processControlBlock);
-	
 	{
 		std::unique_lock<std::mutex> masterListLock(masterListMutex);
 		masterListPCB.push_back(processControlBlock);
 	}
+
+	admitProcess(processControlBlock);
 }
 
 void CPU::createProcess_Generator(unsigned long long ID, size_t heapSize, std::vector<std::unique_ptr<Instruction>>&& instructions, size_t priority, size_t memoryRequired) // Generator Function only
@@ -178,16 +590,12 @@ void CPU::createProcess_Generator(unsigned long long ID, size_t heapSize, std::v
 			processControlBlock->setName("Process_" + std::to_string(processesGenerated));
 		}
 
-		{
-			std::unique_lock<std::mutex> coreLock(coreMutex);
-			cores[ID % cores.size()]->assign(processControlBlock);
-		}
-
 		{
 			std::unique_lock<std::mutex> masterListLock(masterListMutex);
 			masterListPCB.push_back(processControlBlock);
 		}
 
+		admitProcess(processControlBlock);
 	}
 }
 
@@ -216,6 +624,58 @@ void CPU::generatorFunction()
 	}
 }
 
+void CPU::admitProcess(std::shared_ptr<PCB> processControlBlock)
+{
+	std::unique_lock<std::mutex> admissionLock(admissionMutex);
+
+	processControlBlock->setQueuedAt(GlobalClock::getInstance().getTicks());
+
+	// Admission is in arrival order, a new process never passes one
+	// that is already waiting
+	if (admissionQueue.empty() && tryAdmit(processControlBlock))
+	{
+		return;
+	}
+
+	admissionQueue.push_back(processControlBlock);
+}
+
+bool CPU::tryAdmit(const std::shared_ptr<PCB>& processControlBlock)
+{
+	unsigned long long ID = processControlBlock->getProcessID();
+
+	if (!memoryManager.reserveFrames(ID, processControlBlock->getMemoryRequired(), config.reservedFramesPerProcess))
+	{
+		return false;
+	}
+
+	processControlBlock->setAdmittedAt(GlobalClock::getInstance().getTicks());
+	admittedProcesses++;
+	totalAdmissionDelay += processControlBlock->getAdmissionDelay();
+
+	{
+		std::unique_lock<std::mutex> coreLock(coreMutex);
+		cores[ID % cores.size()]->assign(processControlBlock);
+	}
+
+	return true;
+}
+
+void CPU::admissionFunction()
+{
+	while (admissionRunning)
+	{
+		GlobalClock::getInstance().waitForTick();
+
+		std::unique_lock<std::mutex> admissionLock(admissionMutex);
+
+		while (!admissionQueue.empty() && tryAdmit(admissionQueue.front()))
+		{
+			admissionQueue.pop_front();
+		}
+	}
+}
+
 size_t CPU::generateRandomNumber(size_t minimum, size_t maximum)
 {
 	static thread_local std::mt19937_64 RNG{ std::random_device{}() };
@@ -554,6 +1014,98 @@ CONFIGURATION CPU::readConfig()
 
 			rtrn.minimumMemoryPerProcess = exponent;
 		}
+		else if (firstToken == "read-ahead-window")
+		{
+			if (tokens.size() > 2)
+			{
+				rtrn.readAheadWindow = 0;
+				continue;
+			}
+
+			size_t window = std::stoul(tokens.at(1));
+			rtrn.readAheadWindow = std::min(window, static_cast<size_t>(64));
+		}
+		else if (firstToken == "compressed-pool-size")
+		{
+			if (tokens.size() > 2)
+			{
+				rtrn.compressedPoolSize = 0;
+				continue;
+			}
+
+			rtrn.compressedPoolSize = std::stoul(tokens.at(1));
+		}
+		else if (firstToken == "huge-page-size")
+		{
+			if (tokens.size() > 2)
+			{
+				rtrn.hugePageSize = 0;
+				continue;
+			}
+
+			size_t value = std::stoul(tokens.at(1));
+
+			// 0 turns huge pages off
+			if (value == 0)
+			{
+				rtrn.hugePageSize = 0;
+				continue;
+			}
+
+			if ((value & (value - 1)) != 0)
+			{
+				throw std::invalid_argument("Value must be a power of 2");
+			}
+
+			size_t exponent = static_cast<size_t>(std::log2(value));
+
+			rtrn.hugePageSize = exponent;
+		}
+		else if (firstToken == "reserved-frames-per-process")
+		{
+			if (tokens.size() > 2)
+			{
+				rtrn.reservedFramesPerProcess = 0;
+				continue;
+			}
+
+			// 0 admits every process without a reservation
+			rtrn.reservedFramesPerProcess = std::stoul(tokens.at(1));
+		}
+		else if (firstToken == "backing-store-mode")
+		{
+			if (tokens.size() > 2)
+			{
+				rtrn.backingStoreMode = "FILE";
+				continue;
+			}
+
+			if (tokens.at(1) == "MMAP")
+			{
+				rtrn.backingStoreMode = tokens.at(1);
+			}
+			else
+			{
+				rtrn.backingStoreMode = "FILE";
+			}
+		}
+		else if (firstToken == "page-replacement")
+		{
+			if (tokens.size() > 2)
+			{
+				rtrn.pageReplacement = "LRU";
+				continue;
+			}
+
+			if (ReplacementPolicy::isPolicyName(tokens.at(1)))
+			{
+				rtrn.pageReplacement = tokens.at(1);
+			}
+			else
+			{
+				rtrn.pageReplacement = "LRU";
+			}
+		}
 	}
 
 	return rtrn;
@@ -578,8 +1130,9 @@ std::vector<std::string> CPU::tokenize(std::string line, char delimeter)
 // ----- << Public Member Function Implementation >> ------ //
 CPU::CPU()
 	: config(readConfig()),
-	memoryManager(config.maximumMemoryPerProcess, config.maximumOverallMemory, config.memoryPerFrame, config.minimumMemoryPerProcess, breaker),
-	generatorRunning(false), processesGenerated(0)
+	memoryManager(config.maximumMemoryPerProcess, config.maximumOverallMemory, config.memoryPerFrame, config.minimumMemoryPerProcess, config.pageReplacement, config.backingStoreMode, "backing-store.bin", config.readAheadWindow, config.compressedPoolSize, config.hugePageSize, breaker),
+	generatorRunning(false), admissionRunning(true), processesGenerated(0),
+	admittedProcesses(0), totalAdmissionDelay(0)
 {
 	// Start the clock
 	GlobalClock::getInstance().startClock();
@@ -591,10 +1144,19 @@ CPU::CPU()
 	{
 		cores.push_back(std::make_unique<Core>(config.schedulerAlgorithm, i, config.delayPerInstructionExecution, config.quantumCycle, memoryManager, booleanVector));
 	}
+
+	admissionThread = std::thread(&CPU::admissionFunction, this);
 }
 
 CPU::~CPU()
 {
+	admissionRunning = false;
+
+	if (admissionThread.joinable())
+	{
+		admissionThread.join();
+	}
+
 	for (auto& core : cores)
 	{
 		core->shutdown();
@@ -821,7 +1383,17 @@ void CPU::printProcessLog(std::string name)
 			{
 				// ID and Name
 				output += "\nProcess ID: " + std::to_string(processControlBlock->getProcessID());
-				output += "\nProcess Name: " + processControlBlock->getName() + "\n\n";
+				output += "\nProcess Name: " + processControlBlock->getName() + "\n";
+
+				// Time spent waiting for admission, not running
+				if (processControlBlock->getState() == PCB::PROCESS_STATE::NEW)
+				{
+					output += "\nAdmission: QUEUED\n\n";
+				}
+				else
+				{
+					output += "\nAdmission Delay: " + std::to_string(processControlBlock->getAdmissionDelay()) + " ticks\n\n";
+				}
 
 				// Collect the log
 				output += processControlBlock->getLog() + "\n";
@@ -904,6 +1476,15 @@ void CPU::printProcessStatus()
 				//running << processControlBlock->getName() + "\n";
 				rString = std::to_string(processControlBlock->getProgramCounter()) + " / " + std::to_string(processControlBlock->getProcess().getTextSection().getInstructionAll().size());
 
+				if (processControlBlock->getState() == PCB::PROCESS_STATE::SUSPENDED)
+				{
+					rString += " SUSPENDED";
+				}
+				else if (processControlBlock->getState() == PCB::PROCESS_STATE::NEW)
+				{
+					rString += " QUEUED";
+				}
+
 				running << std::left << std::setw(columnLength) << processControlBlock->getName()
 					<< std::left << std::setw(columnLength) << rString << '\n';
 			}
@@ -1112,6 +1693,107 @@ void CPU::visualizeMemoryDetailed()
 		<< std::left << std::setw(columnLength) << memoryManager.getPagesOut()
 		<< "\n";
 
+	// Dirty victims written back during a page fault
+	output << std::left << std::setw(columnLength) << "Sync Write-backs"
+		<< std::left << std::setw(columnLength) << memoryManager.getSyncWriteBacks()
+		<< "\n";
+
+	// Dirty frames written back by the flusher
+	output << std::left << std::setw(columnLength) << "Async Write-backs"
+		<< std::left << std::setw(columnLength) << memoryManager.getAsyncWriteBacks()
+		<< "\n";
+
+	// Page ins served by the compressed swap pool
+	output << std::left << std::setw(columnLength) << "Swap Pool Hits"
+		<< std::left << std::setw(columnLength) << memoryManager.getSwapPoolHits()
+		<< "\n";
+
+	output << std::left << std::setw(columnLength) << "Swap Compression Ratio"
+		<< std::left << std::setw(columnLength) << std::fixed << std::setprecision(2) << memoryManager.getCompressionRatio()
+		<< "\n";
+
+	// Frames that identical clean pages were merged into
+	output << std::left << std::setw(columnLength) << "Shared Frames"
+		<< std::left << std::setw(columnLength) << memoryManager.getSharedFrames()
+		<< "\n";
+
+	output << std::left << std::setw(columnLength) << "Merged Pages"
+		<< std::left << std::setw(columnLength) << memoryManager.getMergedPages()
+		<< "\n";
+
+	output << std::left << std::setw(columnLength) << "Copy-on-Writes"
+		<< std::left << std::setw(columnLength) << memoryManager.getCopyOnWrites()
+		<< "\n";
+
+	// Page faults serviced, and per 1000 references
+	output << std::left << std::setw(columnLength) << "Page Faults"
+		<< std::left << std::setw(columnLength) << memoryManager.getPageFaults()
+		<< "\n";
+
+	output << std::left << std::setw(columnLength) << "Fault Rate (per 1000)"
+		<< std::left << std::setw(columnLength) << std::fixed << std::setprecision(2) << memoryManager.getFaultRate()
+		<< "\n";
+
+	// Frames the processes that are not suspended need resident
+	output << std::left << std::setw(columnLength) << "Active Working Set"
+		<< std::left << std::setw(columnLength) << memoryManager.getActiveWorkingSet()
+		<< "\n";
+
+	output << std::left << std::setw(columnLength) << "Suspended Processes"
+		<< std::left << std::setw(columnLength) << memoryManager.getSuspendedProcesses()
+		<< "\n";
+
+	// Pages brought back in a batch when a suspended process resumed
+	output << std::left << std::setw(columnLength) << "Pages Swapped In"
+		<< std::left << std::setw(columnLength) << memoryManager.getSwappedInPages()
+		<< "\n";
+
+	// Admission control, the queueing delay is kept apart from the
+	// time processes spend on the cores
+	size_t queuedProcesses;
+	double averageAdmissionDelay;
+
+	{
+		std::unique_lock<std::mutex> admissionLock(admissionMutex);
+		queuedProcesses = admissionQueue.size();
+		averageAdmissionDelay = admittedProcesses == 0 ? 0.0 : static_cast<double>(totalAdmissionDelay) / admittedProcesses;
+	}
+
+	output << std::left << std::setw(columnLength) << "Reserved Frames"
+		<< std::left << std::setw(columnLength) << memoryManager.getReservedFrames()
+		<< "\n";
+
+	output << std::left << std::setw(columnLength) << "Admission Queue"
+		<< std::left << std::setw(columnLength) << queuedProcesses
+		<< "\n";
+
+	output << std::left << std::setw(columnLength) << "Admission Delay (ticks)"
+		<< std::left << std::setw(columnLength) << std::fixed << std::setprecision(2) << averageAdmissionDelay
+		<< "\n";
+
+	// Bytes held by page directories and second-level tables
+	output << std::left << std::setw(columnLength) << "Page Table Memory"
+		<< std::left << std::setw(columnLength) << memoryManager.getPageTableMemory()
+		<< "\n";
+
+	size_t tlbHits = 0;
+	size_t tlbMisses = 0;
+
+	for (const auto& core : cores)
+	{
+		tlbHits += core->getTLBHits();
+		tlbMisses += core->getTLBMisses();
+	}
+
+	// READ and WRITE translations served by the per-Core TLBs
+	output << std::left << std::setw(columnLength) << "TLB Hits"
+		<< std::left << std::setw(columnLength) << tlbHits
+		<< "\n";
+
+	output << std::left << std::setw(columnLength) << "TLB Misses"
+		<< std::left << std::setw(columnLength) << tlbMisses
+		<< "\n";
+
 	output << std::setw(lineLength) << std::setfill('-') << "\n";
 
 	std::cout << output.str();
@@ -1195,6 +1877,76 @@ void CPU::visualizeMemorySummary()
 	std::cout << output.str() << "\n";
 }
 
+void CPU::exportBackingStore()
+{
+	size_t exported = memoryManager.exportBackingStore("backing-store.txt");
+
+	std::cout << "Exported " << exported << " frames to backing-store.txt\n";
+}
+
+bool CPU::forkProcess(std::string sourceName, std::string destinationName)
+{
+	// Taken before masterListMutex like the generator does, and
+	// held until the child is listed, so only a fork that succeeds
+	// uses up an ID
+	std::unique_lock<std::mutex> processCountLock(processCountMutex);
+	size_t ID = processesGenerated;
+
+	// Held until the child is listed, so no other process can take
+	// the destination name in between
+	std::unique_lock<std::mutex> masterListLock(masterListMutex);
+	std::shared_ptr<PCB> parent;
+
+	for (auto& processControlBlock : masterListPCB)
+	{
+		if (processControlBlock->getName() == destinationName)
+		{
+			return false;
+		}
+
+		if (processControlBlock->getName() == sourceName)
+		{
+			parent = processControlBlock;
+		}
+	}
+
+	if (!parent || parent->getState() == PCB::PROCESS_STATE::TERMINATED)
+	{
+		return false;
+	}
+
+	std::shared_ptr<PCB> processControlBlock;
+
+	{
+		// The parent is between two instructions while its state
+		// and its memory are copied
+		std::unique_lock<std::mutex> instructionLock = cores[parent->getProcessID() % cores.size()]->lockInstructions();
+
+		if (parent->getState() == PCB::PROCESS_STATE::TERMINATED)
+		{
+			return false;
+		}
+
+		processControlBlock = std::make_shared<PCB>(ID, 256, *parent);
+		processControlBlock->setName(destinationName);
+
+		// A parent without pages yet has nothing to share, the
+		// child gets fresh pages when it is dispatched
+		memoryManager.forkPages(parent->getProcessID(), ID);
+	}
+
+	processesGenerated++;
+	masterListPCB.push_back(processControlBlock);
+	masterListLock.unlock();
+	processCountLock.unlock();
+
+	// The child needs frames of its own once it writes, so it waits
+	// for memory like any new process
+	admitProcess(processControlBlock);
+
+	return true;
+}
+
 void CPU::printConfig() const
 {
 	std::cout << config.batchProcessFrequency << std::endl;
@@ -1204,10 +1956,266 @@ void CPU::printConfig() const
 	std::cout << config.minimumInstructions << std::endl;
 	std::cout << config.quantumCycle << std::endl;
 	std::cout << config.schedulerAlgorithm << std::endl;
+	std::cout << config.pageReplacement << std::endl;
+	std::cout << config.backingStoreMode << std::endl;
+	std::cout << config.readAheadWindow << std::endl;
+	std::cout << config.compressedPoolSize << std::endl;
+	std::cout << config.hugePageSize << std::endl;
+	std::cout << config.reservedFramesPerProcess << std::endl;
 }
 
-// ----- << Protected Member Function Implementation >> ----- //
+void CPU::benchmarkResidency()
+{
+	const size_t frameSize = 8;
+	const size_t lookups = 1000000;
+	const size_t residentFrames = 256;
+
+	for (size_t overallSize = static_cast<size_t>(1) << 14; overallSize <= static_cast<size_t>(1) << 24; overallSize <<= 2)
+	{
+		PhysicalMemory physicalMemory(frameSize, overallSize, "LRU", "FILE", benchmarkStorePath, 0);
+		std::vector<uint8_t> zeroFrame(frameSize, 0);
+		size_t hits = 0;
+
+		// Half of the looked up IDs are resident, the other half miss
+		for (size_t i = 0; i < residentFrames; i++)
+		{
+			physicalMemory.writeBackingStore(i, 1, zeroFrame.data());
+			physicalMemory.updateFrame(i, i);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (size_t i = 0; i < lookups; i++)
+		{
+			if (physicalMemory.find(i % (residentFrames * 2)))
+			{
+				hits++;
+			}
+		}
+
+		auto end = std::chrono::steady_clock::now();
+		double elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+
+		std::cout << std::left << std::setw(12) << overallSize << "bytes : "
+			<< std::fixed << std::setprecision(2) << (elapsed / lookups) << " ns per residency check"
+			<< " (" << hits << " hits)\n";
+	}
+
+	std::remove(benchmarkStorePath);
+}
+
+void CPU::benchmarkReplacement()
+{
+	const size_t numFrames = 1024;
+	const size_t numProcesses = 16;
+	const size_t pagesPerProcess = 256;
+	const size_t hotPages = 16;
+	const size_t referencesPerDispatch = 64;
+	const size_t dispatches = 32768;
+
+	// Round robin over the processes. Each dispatch references a
+	// small hot set (variables) and random pages (READ/WRITE at
+	// random addresses), and every 8th dispatch sweeps the whole
+	// process the way loadProcess does
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<size_t> pageDist(0, pagesPerProcess - 1);
+	std::uniform_int_distribution<size_t> hotDist(0, hotPages - 1);
+	std::uniform_int_distribution<int> percent(0, 99);
+
+	std::vector<unsigned long long> trace;
+	trace.reserve(dispatches * referencesPerDispatch + dispatches / 8 * pagesPerProcess);
+
+	for (size_t dispatch = 0; dispatch < dispatches; dispatch++)
+	{
+		unsigned long long base = (dispatch % numProcesses) * pagesPerProcess;
+
+		if (dispatch % 8 == 0)
+		{
+			for (size_t page = 0; page < pagesPerProcess; page++)
+			{
+				trace.push_back(base + page);
+			}
+		}
+
+		for (size_t i = 0; i < referencesPerDispatch; i++)
+		{
+			trace.push_back(base + (percent(gen) < 70 ? hotDist(gen) : pageDist(gen)));
+		}
+	}
+
+	std::cout << trace.size() << " references, " << numProcesses * pagesPerProcess
+		<< " pages, " << numFrames << " frames\n";
+
+	// Batched replays hits the way PhysicalMemory reports them: once
+	// per slot, in order of first access, when a slot changes frames
+	for (const char* name : { "LRU", "CLOCK", "FIFO", "LFU", "ARC", "2Q" })
+	{
+		for (bool batched : { false, true })
+		{
+			std::unique_ptr<ReplacementPolicy> policy = ReplacementPolicy::create(name, numFrames);
+			std::unordered_map<unsigned long long, size_t> resident;
+			std::vector<unsigned long long> slotFrame(numFrames, 0);
+			std::vector<uint8_t> touched(numFrames, 0);
+			std::vector<size_t> touchedSlots;
+			size_t hits = 0;
+			size_t evictions = 0;
+			size_t nextFree = 0;
+
+			resident.reserve(numFrames);
+
+			auto start = std::chrono::steady_clock::now();
+
+			for (unsigned long long frameID : trace)
+			{
+				auto slot = resident.find(frameID);
+
+				if (slot != resident.end())
+				{
+					if (!batched)
+					{
+						policy->touch(slot->second);
+					}
+					else if (!touched[slot->second])
+					{
+						touched[slot->second] = 1;
+						touchedSlots.push_back(slot->second);
+					}
+
+					hits++;
+					continue;
+				}
+
+				for (size_t touchedSlot : touchedSlots)
+				{
+					touched[touchedSlot] = 0;
+					policy->touch(touchedSlot);
+				}
+
+				touchedSlots.clear();
 
+				size_t victim;
+
+				if (nextFree < numFrames)
+				{
+					victim = nextFree++;
+				}
+				else
+				{
+					victim = *policy->evict();
+					resident.erase(slotFrame[victim]);
+					evictions++;
+				}
+
+				slotFrame[victim] = frameID;
+				resident[frameID] = victim;
+				policy->admit(victim, frameID);
+			}
+
+			auto end = std::chrono::steady_clock::now();
+			double elapsed = std::chrono::duration<double>(end - start).count();
+
+			std::cout << std::left << std::setw(8) << name << std::setw(9) << (batched ? "batched" : "exact")
+				<< std::fixed << std::setprecision(2)
+				<< "hit rate " << std::setw(8) << (100.0 * hits / trace.size())
+				<< "evictions " << std::setw(10) << evictions
+				<< (evictions / elapsed / 1e6) << " M evictions/s\n";
+		}
+	}
+}
+
+void CPU::benchmarkScaling()
+{
+	const size_t maxThreads = 64;
+	const size_t operationsPerThread = 200000;
+	const size_t processMemory = 4096;
+
+	// Threads beyond the host CPUs take turns on them
+	std::cout << "Host CPUs: " << std::thread::hardware_concurrency() << "\n";
+
+	for (size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+	{
+		// 64 processes of 16 frames fit in memory, so no access faults
+		// once the processes are loaded
+		bool benchmarkBreaker = false;
+		MMU benchmarkMMU(12, 18, 8, 6, "LRU", "FILE", benchmarkStorePath, 0, 0, 0, benchmarkBreaker);
+
+		// The flusher and the merger would compete with the threads
+		// for evictionMutex
+		benchmarkMMU.stopBackgroundThreads();
+
+		for (size_t i = 0; i < numThreads; i++)
+		{
+			benchmarkMMU.createPages(i, processMemory);
+			benchmarkMMU.loadProcess(i);
+		}
+
+		std::vector<std::thread> threads;
+		std::vector<size_t> tlbHits(numThreads, 0);
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (size_t i = 0; i < numThreads; i++)
+		{
+			threads.emplace_back([&, i] {
+				TLB tlb(64);
+				std::mt19937 gen(static_cast<unsigned int>(i));
+				std::uniform_int_distribution<uint32_t> addressDist(0, processMemory / 2 - 1);
+
+				for (size_t operation = 0; operation < operationsPerThread; operation++)
+				{
+					uint32_t address = addressDist(gen) * 2;
+
+					if (operation % 2)
+					{
+						benchmarkMMU.protectedWrite(i, address, static_cast<uint16_t>(operation), tlb);
+					}
+					else
+					{
+						benchmarkMMU.protectedRead(i, address, tlb);
+					}
+				}
+
+				tlbHits[i] = tlb.getHits();
+			});
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		auto end = std::chrono::steady_clock::now();
+		double elapsed = std::chrono::duration<double>(end - start).count();
+		double throughput = numThreads * operationsPerThread / elapsed / 1e6;
+
+		size_t hits = 0;
+		for (size_t threadHits : tlbHits)
+		{
+			hits += threadHits;
+		}
+
+		std::cout << std::left << std::setw(4) << numThreads << "threads : "
+			<< std::fixed << std::setprecision(2) << throughput << " M ops/s, "
+			<< (100.0 * hits / (numThreads * operationsPerThread)) << "% TLB hits\n";
+	}
+
+	std::remove(benchmarkStorePath);
+}
+
+bool CPU::selfCheck()
+{
+	bool passed = checkVictimOrder();
+	passed = checkCompressedRoundTrip() && passed;
+	passed = checkPageMerging() && passed;
+	passed = checkForkIsolation() && passed;
+	passed = checkDataSection() && passed;
+
+	std::cout << (passed ? "All checks passed\n" : "Some checks FAILED\n");
+
+	return passed;
+}
+
+// ----- << Protected Member Function Implementation >> ----- //
 std::optional<std::unique_ptr<Instruction>> CPU::interpretADD(std::vector<std::string> instructionTokens)
 {
 	if (instructionTokens.empty())
@@ -1359,7 +2367,12 @@ std::optional<std::unique_ptr<Instruction>> CPU::interpretREAD(std::vector<std::
 
 	if (isHexString(instructionTokens.at(2)) && isValidIdentifier(instructionTokens.at(1)))
 	{
-		return std::make_unique<Instruction_READ>(instructionTokens.at(2), instructionTokens.at(1));
+		std::optional<uint32_t> address = parseHexAddress(instructionTokens.at(2));
+
+		if (address)
+		{
+			return std::make_unique<Instruction_READ>(*address, instructionTokens.at(1));
+		}
 	}
 
 	std::cerr << "Error: Failed to interpret READ instruction\n";
@@ -1451,7 +2464,12 @@ std::optional<std::unique_ptr<Instruction>> CPU::interpretWRITE(std::vector<std:
 
 	if (isHexString(instructionTokens.at(1)) && isAllDigits(instructionTokens.at(2)))
 	{
-		return std::make_unique<Instruction_WRITE>(instructionTokens.at(1), static_cast<uint16_t>(std::stoul(instructionTokens.at(2))));
+		std::optional<uint32_t> address = parseHexAddress(instructionTokens.at(1));
+
+		if (address)
+		{
+			return std::make_unique<Instruction_WRITE>(*address, static_cast<uint16_t>(std::stoul(instructionTokens.at(2))));
+		}
 	}
 
 	std::cerr << "Error: Failed to interpret WRITE instruction\n";
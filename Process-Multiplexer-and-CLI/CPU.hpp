@@ -2,6 +2,7 @@
 
 // ----- << External Library >> ----- //
 #include "Core.hpp"
+#include <deque>
 #include <iostream>
 #include <vector>
 
@@ -16,18 +17,30 @@ private:
 	std::mutex masterListMutex;
 	std::mutex memoryMangerMutex;
 	std::mutex processCountMutex;
+	std::mutex admissionMutex;
 
 	std::thread processGeneratorThread;
+	std::thread admissionThread;
 	
 	// Primitive Data Members
 	bool breaker = false;
 	bool generatorRunning;
+	std::atomic<bool> admissionRunning;
 	unsigned long long processesGenerated;
 
+	size_t admittedProcesses;
+	size_t totalAdmissionDelay;
+			// Processes admitted and the ticks they waited in the
+			// admission queue, guarded by admissionMutex
+
 	// Member Objects
 	std::vector<std::unique_ptr<Core>> cores;
 	std::vector<std::shared_ptr<PCB>> masterListPCB;
 
+	std::deque<std::shared_ptr<PCB>> admissionQueue;
+			// NEW processes waiting for their frame reservation, in
+			// arrival order
+
 	GrowingBooleanVector booleanVector;
 	MMU memoryManager;
 
@@ -96,6 +109,36 @@ private:
 	 */
 	void generatorFunction();
 
+	/**
+	 * @brief	Admits a new process if its frame reservation can
+	 *			be granted and nothing is queued ahead of it. 
+	 *			Otherwise, the process waits in the admission queue
+	 * 
+	 * @param	processControlBlock --
+	 *			The NEW process
+	 */
+	void admitProcess(std::shared_ptr<PCB> processControlBlock);
+
+	/**
+	 * @brief	Reserves frames for a process and assigns it to a
+	 *			core
+	 * 
+	 *			WARNING: Caller must hold admissionMutex
+	 * 
+	 * @param	processControlBlock --
+	 *			The process being admitted
+	 * 
+	 * @return	true if the process was admitted. Otherwise, false.
+	 */
+	bool tryAdmit(const std::shared_ptr<PCB>& processControlBlock);
+
+	/**
+	 * @brief	Admits queued processes in arrival order every
+	 *			tick, stopping at the first whose reservation does
+	 *			not fit
+	 */
+	void admissionFunction();
+
 	/**
 	 * @brief	Generate a random number
 	 * 
@@ -263,6 +306,32 @@ public:
 	std::vector<std::unique_ptr<Instruction>>
 		generateRandomInstructions(size_t count);
 
+	/**
+	 * @brief	Writes the binary backing store to 
+	 *			backing-store.txt as "ID HEXDATA" lines
+	 */
+	void exportBackingStore();
+
+	/**
+	 * @brief	Forks a process. The new process shares the text
+	 *			section of the parent, starts from its program 
+	 *			counter, and shares its memory copy-on-write
+	 * 
+	 * @param	sourceName --
+	 *			Name of the process being forked
+	 * 
+	 * @param	destinationName --
+	 *			Name given to the forked process
+	 * 
+	 * @return	true if the process was forked. Otherwise, false
+	 *			if the source does not exist or has terminated, or
+	 *			the destination name is taken
+	 */
+	bool forkProcess(
+		std::string sourceName, 
+		std::string destinationName
+	);
+
 	/**
 	 * @brief	Get the average utilization of all of the Cores
 	 *			in the CPU
@@ -335,6 +404,51 @@ public:
 	 */
 	void printConfig() const;
 
+	/**
+	 * @brief	Micro-benchmark of the physical memory residency
+	 *			check as the size of the physical memory grows
+	 *			from 16 KiB to 16 MiB
+	 * 
+	 *			Prints the average cost of a single lookup for
+	 *			each memory size. Uses its own scratch backing 
+	 *			store
+	 */
+	void benchmarkResidency();
+
+	/**
+	 * @brief	Replays one synthetic page reference trace under
+	 *			every replacement policy
+	 * 
+	 *			Prints the hit rate, the number of evictions, and
+	 *			the eviction throughput of each policy, once with 
+	 *			every hit reported to the policy and once with hits
+	 *			batched the way PhysicalMemory reports them
+	 */
+	void benchmarkReplacement();
+
+	/**
+	 * @brief	Runs 1 to 64 threads, each issuing READ and WRITE
+	 *			instructions through its own TLB to its own 
+	 *			resident process, the way the Cores do
+	 * 
+	 *			Prints the combined throughput for each thread 
+	 *			count and the CPUs of the host. Uses its own MMU,
+	 *			without the flusher and the merger, and a scratch
+	 *			backing store
+	 */
+	void benchmarkScaling();
+
+	/**
+	 * @brief	Runs the scripted checks of the memory subsystem,
+	 *			each against a result worked out independently
+	 * 
+	 *			Prints PASS or FAIL for every check. Uses its own
+	 *			objects, never the running system
+	 * 
+	 * @return	true if every check passed
+	 */
+	bool selfCheck();
+
 protected: 
 	// Mostly helper functions to assists in debugging
 	// Move to public to use these member functions
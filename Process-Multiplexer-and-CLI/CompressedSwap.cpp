@@ -0,0 +1,252 @@
+// ----- << External Library >> ----- //
+#include "CompressedSwap.hpp"
+#include <cstring>
+#include <stdexcept>
+
+// ----- << Private Member Function Implementation >> ----- //
+std::vector<uint8_t> CompressedSwap::compress(const uint8_t* data) const
+{
+	std::vector<uint8_t> encoded;
+	size_t i = 0;
+
+	while (i < frameSize)
+	{
+		size_t run = 0;
+
+		while (i + run < frameSize && data[i + run] == 0 && run < 128)
+		{
+			run++;
+		}
+
+		// A single zero is cheaper as part of a literal run
+		if (run >= 2 || (run == 1 && i + 1 == frameSize))
+		{
+			encoded.push_back(static_cast<uint8_t>(0x7F + run));
+			i += run;
+			continue;
+		}
+
+		size_t start = i;
+
+		while (i < frameSize && i - start < 128)
+		{
+			if (data[i] == 0 && i + 1 < frameSize && data[i + 1] == 0)
+			{
+				break;
+			}
+
+			i++;
+		}
+
+		encoded.push_back(static_cast<uint8_t>(i - start - 1));
+		encoded.insert(encoded.end(), data + start, data + i);
+	}
+
+	return encoded;
+}
+
+void CompressedSwap::decompress(const std::vector<uint8_t>& encoded, uint8_t* buffer) const
+{
+	size_t out = 0;
+	size_t i = 0;
+
+	while (i < encoded.size())
+	{
+		uint8_t control = encoded[i++];
+
+		if (control >= 0x80)
+		{
+			size_t run = control - 0x7F;
+
+			std::memset(buffer + out, 0, run);
+			out += run;
+		}
+		else
+		{
+			size_t run = static_cast<size_t>(control) + 1;
+
+			std::memcpy(buffer + out, encoded.data() + i, run);
+			out += run;
+			i += run;
+		}
+	}
+
+	if (out != frameSize)
+	{
+		throw std::runtime_error("\nERROR: Corrupt compressed frame\n");
+	}
+}
+
+void CompressedSwap::shrink()
+{
+	std::vector<uint8_t> buffer(frameSize);
+
+	while (compressedBytes > poolCapacity && !usage.empty())
+	{
+		auto victim = pool.find(usage.back());
+
+		if (!victim->second.onDisk)
+		{
+			decompress(victim->second.data, buffer.data());
+			backingStore.write(victim->first, buffer.data());
+			spills++;
+		}
+
+		compressedBytes -= victim->second.data.size() + entryOverhead;
+		usage.pop_back();
+		pool.erase(victim);
+	}
+}
+
+// ----- << Public Member Function Implementation >> ----- //
+CompressedSwap::CompressedSwap(size_t frameSize, size_t poolCapacity, BackingStore& backingStore)
+	: compressedBytes(0), frameSize(frameSize), poolCapacity(poolCapacity), 
+	poolHits(0), spills(0), backingStore(backingStore)
+{
+
+}
+
+CompressedSwap::~CompressedSwap() = default;
+
+double CompressedSwap::getCompressionRatio()
+{
+	std::unique_lock<std::mutex> poolLock(poolMutex);
+
+	if (compressedBytes == 0)
+	{
+		return 0.0;
+	}
+
+	// The ratio is of the data alone, without the entry overhead
+	return static_cast<double>(pool.size() * frameSize) / (compressedBytes - pool.size() * entryOverhead);
+}
+
+size_t CompressedSwap::getPoolHits() const
+{
+	return poolHits;
+}
+
+size_t CompressedSwap::getSpills() const
+{
+	return spills;
+}
+
+void CompressedSwap::discard(unsigned long long firstID, size_t count)
+{
+	std::unique_lock<std::mutex> poolLock(poolMutex);
+
+	for (size_t i = 0; i < count && !pool.empty(); i++)
+	{
+		auto entry = pool.find(firstID + i);
+
+		if (entry == pool.end())
+		{
+			continue;
+		}
+
+		compressedBytes -= entry->second.data.size() + entryOverhead;
+		usage.erase(entry->second.position);
+		pool.erase(entry);
+	}
+}
+
+size_t CompressedSwap::exportText(const std::string& exportPath)
+{
+	std::unique_lock<std::mutex> poolLock(poolMutex);
+
+	std::vector<uint8_t> buffer(frameSize);
+
+	for (auto& [ID, entry] : pool)
+	{
+		if (!entry.onDisk)
+		{
+			decompress(entry.data, buffer.data());
+			backingStore.write(ID, buffer.data());
+			entry.onDisk = true;
+		}
+	}
+
+	return backingStore.exportText(exportPath);
+}
+
+bool CompressedSwap::read(unsigned long long ID, uint8_t* buffer)
+{
+	std::unique_lock<std::mutex> poolLock(poolMutex);
+
+	auto entry = pool.find(ID);
+
+	if (entry == pool.end())
+	{
+		return backingStore.read(ID, buffer);
+	}
+
+	// The entry stays pooled, so a clean page out needs no write
+	decompress(entry->second.data, buffer);
+	usage.splice(usage.begin(), usage, entry->second.position);
+	poolHits++;
+
+	return true;
+}
+
+void CompressedSwap::readRange(unsigned long long firstID, size_t count, uint8_t* buffer)
+{
+	std::unique_lock<std::mutex> poolLock(poolMutex);
+
+	bool allPooled = true;
+
+	for (size_t i = 0; i < count && allPooled; i++)
+	{
+		allPooled = pool.count(firstID + i) != 0;
+	}
+
+	if (!allPooled)
+	{
+		backingStore.readRange(firstID, count, buffer);
+	}
+
+	// Pooled frames are newer than their backing store slots
+	for (size_t i = 0; i < count; i++)
+	{
+		auto entry = pool.find(firstID + i);
+
+		if (entry == pool.end())
+		{
+			continue;
+		}
+
+		decompress(entry->second.data, buffer + i * frameSize);
+		usage.splice(usage.begin(), usage, entry->second.position);
+		poolHits++;
+	}
+}
+
+void CompressedSwap::write(unsigned long long ID, const uint8_t* data)
+{
+	std::unique_lock<std::mutex> poolLock(poolMutex);
+
+	std::vector<uint8_t> encoded = poolCapacity ? compress(data) : std::vector<uint8_t>();
+	auto entry = pool.find(ID);
+
+	if (entry != pool.end())
+	{
+		compressedBytes -= entry->second.data.size() + entryOverhead;
+		usage.erase(entry->second.position);
+		pool.erase(entry);
+	}
+
+	// Frames that do not shrink are not worth the pool
+	if (encoded.empty() || encoded.size() >= frameSize)
+	{
+		backingStore.write(ID, data);
+		return;
+	}
+
+	compressedBytes += encoded.size() + entryOverhead;
+	usage.push_front(ID);
+
+	Entry& pooled = pool[ID];
+	pooled.data = std::move(encoded);
+	pooled.position = usage.begin();
+
+	shrink();
+}
\ No newline at end of file
@@ -0,0 +1,211 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include "BackingStore.hpp"
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// ----- << Class >> ----- //
+/**
+ * @brief	A compressed swap tier in front of the backing store
+ * 
+ *			Frames that are paged out are compressed and kept in
+ *			an in-memory pool of at most poolCapacity bytes, 
+ *			counting the bookkeeping of every entry, so most 
+ *			page ins are a decompress instead of
+ *			file I/O. The pool has its own LRU and the least 
+ *			recently used frames spill to the backing store when
+ *			it overflows. Frames that do not compress go straight
+ *			to the backing store
+ * 
+ *			Encoding: a control byte below 0x80 is followed by 
+ *			control + 1 literal bytes, and a control byte of 0x80
+ *			or above stands for control - 0x7F zero bytes
+ */
+class CompressedSwap
+{
+private:
+	/**
+	 * @brief	A compressed frame in the pool
+	 */
+	struct Entry
+	{
+		std::vector<uint8_t> data;
+		std::list<unsigned long long>::iterator position;
+				// Position in usage
+		bool onDisk = false;
+				// The backing store slot holds the same data, so
+				// the entry can be dropped without a write
+	};
+
+	static constexpr size_t entryOverhead = 96;
+			// Bytes charged for every entry on top of its data, 
+			// roughly its map node, usage node and allocation, so
+			// frames that compress to almost nothing cannot grow
+			// the pool without bound
+
+	// Primitive Data Members
+	size_t compressedBytes;
+			// Compressed data plus entryOverhead per entry
+	size_t frameSize;
+	size_t poolCapacity;
+
+	std::atomic<size_t> poolHits;
+	std::atomic<size_t> spills;
+
+	// User-defined Data Members
+	std::mutex poolMutex;
+
+	BackingStore& backingStore;
+
+	std::unordered_map<unsigned long long, Entry> pool;
+			// Frame ID, Compressed frame
+
+	std::list<unsigned long long> usage;
+			// Frame IDs, most recently used first
+
+	/**
+	 * @brief	Encodes a frame
+	 * 
+	 * @param	data --
+	 *			Source of frameSize bytes
+	 * 
+	 * @return	The encoded frame
+	 */
+	std::vector<uint8_t> compress(const uint8_t* data) const;
+
+	/**
+	 * @brief	Decodes a frame
+	 * 
+	 * @param	encoded --
+	 *			The encoded frame
+	 * 
+	 * @param	buffer --
+	 *			Destination of frameSize bytes
+	 */
+	void decompress(const std::vector<uint8_t>& encoded, uint8_t* buffer) const;
+
+	/**
+	 * @brief	Spills the least recently used frames until the
+	 *			pool fits in poolCapacity
+	 * 
+	 *			WARNING: Caller must hold poolMutex
+	 */
+	void shrink();
+
+public:
+	/**
+	 * @brief	Class constructor
+	 * 
+	 * @param	frameSize --
+	 *			The number of bytes in every frame
+	 * 
+	 * @param	poolCapacity --
+	 *			Most bytes held in memory, compressed data plus
+	 *			the overhead of every entry. 0 disables the pool
+	 * 
+	 * @param	backingStore --
+	 *			Where frames spill to
+	 */
+	CompressedSwap(size_t frameSize, size_t poolCapacity, BackingStore& backingStore);
+
+	/**
+	 * @brief	Class destructor
+	 */
+	~CompressedSwap();
+
+	/**
+	 * @brief	Get the uncompressed size of the frames in the pool
+	 *			over their compressed size
+	 * 
+	 * @return	The compression ratio. 0 if the pool is empty
+	 */
+	double getCompressionRatio();
+
+	/**
+	 * @brief	Get the number of frames read from the pool 
+	 *			instead of the backing store
+	 * 
+	 * @return	The number of pool hits
+	 */
+	size_t getPoolHits() const;
+
+	/**
+	 * @brief	Get the number of frames written to the backing
+	 *			store when they left the pool
+	 * 
+	 * @return	The number of spills
+	 */
+	size_t getSpills() const;
+
+	/**
+	 * @brief	Drops consecutive frames from the pool without 
+	 *			writing them, once no page uses them anymore
+	 * 
+	 * @param	firstID --
+	 *			The unique ID of the first frame
+	 * 
+	 * @param	count --
+	 *			The number of frames dropped
+	 */
+	void discard(unsigned long long firstID, size_t count);
+
+	/**
+	 * @brief	Writes every frame, pooled or not, as a "ID HEXDATA"
+	 *			line for debugging. Pooled frames are written to the
+	 *			backing store first
+	 * 
+	 * @param	exportPath --
+	 *			The text file that is written
+	 * 
+	 * @return	The number of frames written
+	 */
+	size_t exportText(const std::string& exportPath);
+
+	/**
+	 * @brief	Reads a frame from the pool, or from the backing
+	 *			store if it is not pooled
+	 * 
+	 * @param	ID --
+	 *			The unique ID that identifies a frame
+	 * 
+	 * @param	buffer --
+	 *			Destination of frameSize bytes
+	 * 
+	 * @return	true if the frame was read. false if the frame was
+	 *			never written
+	 */
+	bool read(unsigned long long ID, uint8_t* buffer);
+
+	/**
+	 * @brief	Reads consecutive frames. The backing store is only
+	 *			read, in a single read, when one of them is not
+	 *			pooled
+	 * 
+	 * @param	firstID --
+	 *			The unique ID of the first frame
+	 * 
+	 * @param	count --
+	 *			The number of frames read
+	 * 
+	 * @param	buffer --
+	 *			Destination of count * frameSize bytes
+	 */
+	void readRange(unsigned long long firstID, size_t count, uint8_t* buffer);
+
+	/**
+	 * @brief	Compresses a frame into the pool, replacing an older
+	 *			copy of it
+	 * 
+	 * @param	ID --
+	 *			The unique ID that identifies a frame
+	 * 
+	 * @param	data --
+	 *			Source of frameSize bytes
+	 */
+	void write(unsigned long long ID, const uint8_t* data);
+};
\ No newline at end of file
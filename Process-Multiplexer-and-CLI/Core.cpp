@@ -8,41 +8,10 @@
 #include "Instruction_SLEEP.hpp"
 #include "Instruction_SUBTRACT.hpp"
 #include "Instruction_WRITE.hpp"
-#include <iomanip>
-#include <sstream>
 
 // TODO: Fix RR scheduler, context switch overhead is too large
 
 // ----- << Private Member Function Implementation >> ----- //
-std::string Core::convertDecToHex(size_t dec)
-{
-	std::ostringstream stream;
-
-	stream << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << dec;
-
-	return stream.str();
-}
-
-size_t Core::convertHexToDecimal(std::string hex)
-{
-	size_t result = 0;
-
-	try
-	{
-		result = std::stoul(hex, nullptr, 16);
-	}
-	catch (const std::invalid_argument& e)
-	{
-		throw std::runtime_error("Invalid Hex String: " + hex);
-	}
-	catch (const std::out_of_range& e)
-	{
-		throw std::runtime_error("Hex String out of range: " + hex);
-	}
-
-	return result;
-}
-
 void Core::executeInstruction(Process& process, const std::unique_ptr<Instruction>& instruction)
 {
 	INSTRUCTION_TYPE typeIdentifier = instruction->getInstructionType();
@@ -112,23 +81,9 @@ void Core::executeProcess()
 		readyQueue.pop();
 	}
 
+	// Pages are faulted in by READ and WRITE on first touch
 	currentPCB = substitute;
 
-	{
-		std::unique_lock<std::mutex> memoryManagerLock(memoryManagerMutex);
-
-		if (!memoryManager.loadProcess(currentPCB->getProcessID()))
-		{
-			{
-				currentPCB->setState(PCB::PROCESS_STATE::READY);
-				readyQueue.push(currentPCB);
-			}
-
-			currentPCB.reset();
-			return;
-		}
-	}
-
 	Process& process = currentPCB->getProcess();
 	auto& instructions = process.getTextSection().getInstructionAll();
 
@@ -143,14 +98,11 @@ void Core::executeProcess()
 		{
 			std::unique_lock<std::mutex> instructionLock(instructionMutex);
 			executeInstruction(process, instruction);
+			currentPCB->incrementProgramCounter();
 		}
-		currentPCB->incrementProgramCounter();
 	}
 
-	{
-		std::unique_lock<std::mutex> memoryMangerLock(memoryManagerMutex);
-		memoryManager.remove(currentPCB->getProcessID());
-	}
+	memoryManager.remove(currentPCB->getProcessID());
 	currentPCB->setState(PCB::PROCESS_STATE::TERMINATED);
 	currentPCB.reset();
 }
@@ -177,32 +129,40 @@ void Core::executeProcessLimited(size_t programCounterIncrease)
 
 	{
 		std::unique_lock<std::mutex> readyLock(readyQueueMutex);
-		if (readyQueue.empty())
-		{
-			return;
-		}
-		substitute = readyQueue.front();
-		readyQueue.pop();
-	}
 
-	currentPCB = substitute;
-
-	{
-		std::unique_lock<std::mutex> memoryManagerLock(memoryManagerMutex);
-		
-
-		if (!memoryManager.loadProcess(currentPCB->getProcessID()))
+		// Rotate past processes that load control keeps suspended
+		for (size_t attempts = readyQueue.size(); attempts > 0; attempts--)
 		{
+			std::shared_ptr<PCB> candidate = readyQueue.front();
+			readyQueue.pop();
+
+			if (memoryManager.activate(candidate->getProcessID()))
 			{
-				currentPCB->setState(PCB::PROCESS_STATE::READY);
-				readyQueue.push(currentPCB);
+				substitute = candidate;
+				break;
 			}
 
-			currentPCB.reset();
-			return;
+			readyQueue.push(candidate);
 		}
 	}
 
+	if (!substitute)
+	{
+		// Every ready process is suspended, wait for frames to free
+		GlobalClock::getInstance().waitForTick();
+		return;
+	}
+
+	// A resumed process gets its pages back in one batch instead of
+	// faulting on each of them
+	if (substitute->getState() == PCB::PROCESS_STATE::SUSPENDED)
+	{
+		memoryManager.swapIn(substitute->getProcessID());
+	}
+
+	// Every other page is faulted in by READ and WRITE on first
+	// touch
+	currentPCB = substitute;
 
 	Process& process = currentPCB->getProcess();
 	auto& instructions = process.getTextSection().getInstructionAll();
@@ -221,25 +181,24 @@ void Core::executeProcessLimited(size_t programCounterIncrease)
 		{
 			std::unique_lock<std::mutex> instructionLock(instructionMutex);
 			executeInstruction(process, instructions.at(i));
+			currentPCB->incrementProgramCounter();
 		}
-		currentPCB->incrementProgramCounter();
 	}
 
 	if (currentPCB->getProgramCounter() >= instructions.size())
 	{
-		{
-			std::unique_lock<std::mutex> memoryMangerLock(memoryManagerMutex);
-			memoryManager.remove(currentPCB->getProcessID());
-		}
+		memoryManager.remove(currentPCB->getProcessID());
 
 		currentPCB->setState(PCB::PROCESS_STATE::TERMINATED);
 		currentPCB.reset();
 	}
 	else
 	{
-		
+		bool suspended = memoryManager.suspendIfOvercommitted(currentPCB->getProcessID());
+
 		{
-			currentPCB->setState(PCB::PROCESS_STATE::READY);
+			std::unique_lock<std::mutex> readyLock(readyQueueMutex);
+			currentPCB->setState(suspended ? PCB::PROCESS_STATE::SUSPENDED : PCB::PROCESS_STATE::READY);
 			readyQueue.push(currentPCB);
 		}
 
@@ -257,7 +216,7 @@ void Core::fillDataSection(Process& process, std::string variableName)
 
 size_t Core::fillLogicalDataSection(Process& process, std::string variableName)
 {
-	if (process.getLogicalDataSection().getVariableAddress(variableName))
+	if (process.getLogicalDataSection().contains(variableName))
 	{
 		return 0;
 	}
@@ -374,7 +333,8 @@ void Core::schedulerRR()
 // ----- << Public Member Function Implementation >> ----- //
 Core::Core(std::string algorithm, size_t coreID, size_t delayPerExecution, size_t quantum, MMU& memoryManager, GrowingBooleanVector& booleanVector)
 	: delayPerExecution(delayPerExecution), coreID(coreID), quantumCycle(quantum), isBusy(false), schedulerRunning(true),
-	memoryManager(memoryManager), booleanVector(booleanVector), busyTime(0), idleTime(0), window(10)
+	memoryManager(memoryManager), booleanVector(booleanVector), busyTime(0), idleTime(0), window(10),
+	tlb(64)
 {
 	actualDelay = delayPerExecution + 1;
 
@@ -403,14 +363,16 @@ void Core::assign(std::shared_ptr<PCB> processControlBlock)
 	std::unique_lock<std::mutex> lock(addProcessMutex);
 	processControlBlock->setState(PCB::PROCESS_STATE::READY);
 
-	{
-		std::unique_lock<std::mutex> memoryManagerLock(memoryManagerMutex);
-		memoryManager.createPages(processControlBlock->getProcessID(), processControlBlock->getMemoryRequired());
-	}
+	memoryManager.createPages(processControlBlock->getProcessID(), processControlBlock->getMemoryRequired());
 
 	readyQueue.push(processControlBlock);
 }
 
+std::unique_lock<std::mutex> Core::lockInstructions()
+{
+	return std::unique_lock<std::mutex>(instructionMutex);
+}
+
 std::pair<unsigned long long, std::optional<std::string>> Core::getCurrentID()
 {
 	std::unique_lock<std::mutex> currentLock(currentMutex);
@@ -422,6 +384,16 @@ std::pair<unsigned long long, std::optional<std::string>> Core::getCurrentID()
 	return { -1 , std::nullopt };
 }
 
+size_t Core::getTLBHits() const
+{
+	return tlb.getHits();
+}
+
+size_t Core::getTLBMisses() const
+{
+	return tlb.getMisses();
+}
+
 double Core::getUtilization()
 {
 	/*
@@ -579,7 +551,7 @@ bool Core::execute_DECLARE(Process& process, const std::unique_ptr<Instruction>&
 {
 	if (auto INST = dynamic_cast<Instruction_DECLARE*>(instruction.get()))
 	{
-		if (!process.getLogicalDataSection().getVariableAddress(INST->getName()))
+		if (!process.getLogicalDataSection().contains(INST->getName()))
 		{
 			bool insertStatus = process.getLogicalDataSection().insertVariable(INST->getName());
 
@@ -687,15 +659,12 @@ bool Core::execute_READ(Process& process, const std::unique_ptr<Instruction>& in
 {
 	if (auto INST = dynamic_cast<Instruction_READ*>(instruction.get()))
 	{
-		std::optional<std::string> read;
-		{
-			std::unique_lock<std::mutex> memoryManagerLock(memoryManagerMutex);
-			read = memoryManager.protectedRead(currentPCB->getProcessID(), INST->getAddress(), 2);	
-		}
+		// The MMU locks the page table of the process itself
+		std::optional<uint16_t> read = memoryManager.protectedRead(currentPCB->getProcessID(), INST->getAddress(), tlb);
 
 		if (read)
 		{
-			if (process.getLogicalDataSection().setValue(INST->getDestination(), static_cast<uint16_t>(convertHexToDecimal(*read))))
+			if (process.getLogicalDataSection().setValue(INST->getDestination(), *read))
 			{
 				// Debugging
 				//process.getLogicalDataSection().print();
@@ -856,12 +825,8 @@ bool Core::execute_WRITE(Process& process, const std::unique_ptr<Instruction>& i
 
 	if (auto INST = dynamic_cast<Instruction_WRITE*>(instruction.get()))
 	{
-		bool write;
-		
-		{
-			std::unique_lock<std::mutex> memoryManagerLock(memoryManagerMutex);
-			write = memoryManager.protectedWrite(currentPCB->getProcessID(), INST->getAddress(), convertDecToHex(INST->getData()));
-		}
+		// The MMU locks the page table of the process itself
+		bool write = memoryManager.protectedWrite(currentPCB->getProcessID(), INST->getAddress(), INST->getData(), tlb);
 
 		if (write)
 		{
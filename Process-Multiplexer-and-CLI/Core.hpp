@@ -6,6 +6,7 @@
 #include "MMU.hpp"
 #include "PCB.hpp"
 #include "Process.hpp"
+#include "TLB.hpp"
 
 #include <mutex>
 #include <queue>
@@ -32,7 +33,6 @@ private:
 	std::mutex busyMutex;
 	std::mutex currentMutex;
 	std::mutex instructionMutex;
-	std::mutex memoryManagerMutex;
 	std::mutex readyQueueMutex;
 	std::mutex schedulerMutex;
 	std::mutex timingVectorMutex;
@@ -54,30 +54,9 @@ private:
 
 	GrowingBooleanVector& booleanVector;
 	MMU& memoryManager;
+	TLB tlb;
+			// Only used by the scheduler thread
 	
-	/**
-	 * @brief	Conversts a decimal number to a hexadecimal string
-	 *
-	 * @param	dec --
-	 *			The number that is being converted
-	 *
-	 * @return	An equivalent hexadecimal string representation of
-	 *			the decimal number
-	 */
-	std::string convertDecToHex(size_t dec);
-
-	/**
-	 * @brief	Converts a string of hexadecmial numbers to a
-	 *			decimal number
-	 *
-	 * @param	hex --
-	 *			The string of hexadecimal characters is being
-	 *			converted
-	 *
-	 * @return	Decimal equivalent of the hexadecimal string
-	 */
-	size_t convertHexToDecimal(std::string hex);
-
 	/**
 	 * @brief	Executes an instruction from the process 
 	 */
@@ -95,6 +74,11 @@ private:
 	/**
 	 * @brief	Executes a limited number of instructions in
 	 *			the process
+	 * 
+	 *			Processes suspended by load control are skipped 
+	 *			until their working set fits in physical memory, 
+	 *			and a process is suspended at the end of its time
+	 *			slice while memory is overcommitted
 	 *
 	 * @param	programCounterIncrease --
 	 *			The number of instructions that is going to be
@@ -174,6 +158,15 @@ public:
 	 */
 	void assign(std::shared_ptr<PCB> processControlBlock);
 
+	/**
+	 * @brief	Holds the Core between two instructions, so the
+	 *			state of the process it runs can be copied
+	 * 
+	 * @return	The held lock. The Core continues once it is
+	 *			released
+	 */
+	std::unique_lock<std::mutex> lockInstructions();
+
 	/**
 	 * @brief	Get the processID of the process the core is
 	 *			currently executing
@@ -185,6 +178,18 @@ public:
 	std::pair<unsigned long long, std::optional<std::string>> 
 		getCurrentID();
 
+	/**
+	 * @brief	Get the number of READ and WRITE translations that
+	 *			hit the TLB of the Core
+	 */
+	size_t getTLBHits() const;
+
+	/**
+	 * @brief	Get the number of READ and WRITE translations that
+	 *			missed the TLB of the Core
+	 */
+	size_t getTLBMisses() const;
+
 	/**
 	 * @brief	Get the utilization of the Core
 	 *
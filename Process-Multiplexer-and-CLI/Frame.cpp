@@ -2,22 +2,13 @@
 #include "Frame.hpp"
 #include <iomanip>
 #include <iostream>
-#include <sstream>
+#include <stdexcept>
 
 // ----- << Implementation >> ----- //
-Frame::Frame(unsigned long long ID, size_t size)
-	: frameID(ID), frameSize(size)
+Frame::Frame(unsigned long long ID, uint8_t* data, size_t size)
+	: frameID(ID), frameData(data), frameSize(size)
 {
-	// Eeach address location consumes 1 byte
-	for (unsigned long long i = 0; i < size; i++)
-	{
-		std::ostringstream stream;
-		stream	<< std::hex << std::uppercase
-				<< std::setw(5) << std::setfill('0') << i;
-		std::string key = stream.str();
 
-		frameData[key] = "00";
-	}
 }
 
 Frame::~Frame() = default;
@@ -27,19 +18,26 @@ unsigned long long Frame::getID() const
 	return frameID;
 }
 
-std::string Frame::read(std::string frameAddress)
+uint8_t* Frame::data() const
+{
+	return frameData;
+}
+
+uint8_t Frame::read(size_t offset) const
 {
-	return frameData.at(frameAddress);
+	if (offset >= frameSize)
+	{
+		throw std::out_of_range("\nERROR: Frame offset out of range\n");
+	}
+
+	return frameData[offset];
 }
 
-void Frame::write(std::string frameAddress, std::string data)
+void Frame::write(size_t offset, uint8_t data)
 {
-	//std::unique_lock<std::mutex> writeLock(frameWriteMutex);
-	auto frame = frameData.find(frameAddress);
-	
-	if (frame != frameData.end())
+	if (offset < frameSize)
 	{
-		frame->second = data;
+		frameData[offset] = data;
 	}
 	else
 	{
@@ -55,9 +53,12 @@ bool Frame::operator==(const Frame& frame) const
 void Frame::print() const
 {
 	std::cout << "\n\nFrame ID: " << frameID << "\n\n";
-	for (auto pair = frameData.begin(); pair != frameData.end(); pair++)
+	for (size_t i = 0; i < frameSize; i++)
 	{
-		std::cout << pair->first << " : " << pair->second << "\n";
+		std::cout << std::hex << std::uppercase
+			<< std::setw(5) << std::setfill('0') << i << " : "
+			<< std::setw(2) << static_cast<unsigned int>(frameData[i])
+			<< std::dec << std::setfill(' ') << "\n";
 	}
 }
 
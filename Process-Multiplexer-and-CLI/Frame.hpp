@@ -1,14 +1,17 @@
 #pragma once
 
 // ----- << External Library >> ----- //
-#include <map>
-//#include <mutex>
+#include <cstdint>
 #include <string>
 
 // ----- << Class >> ----- //
 
 /**
  * @brief	A class that emulates a frame for PHYSICAL MEMORY
+ * 
+ *			The frame does not own its bytes. It is a view into
+ *			the contiguous storage of the PHYSICAL MEMORY that
+ *			starts at the offset of the slot it is loaded in
  */
 class Frame
 {
@@ -16,20 +19,17 @@ private:
 	// Primitive Data Members
 	unsigned long long frameID;
 
+	uint8_t* frameData;
+			// Start of the frame inside the physical memory slab
+
 	// User-defined Data Members
 	size_t frameSize; // in bytes
 
-	std::map<std::string, std::string> frameData;
-			// Address in Hex : Byte
-
-
-	// User-defined Data Members
-	//std::mutex frameWriteMutex;
 public:
 	/**
 	 * @brief	Class constructor
 	 */
-	Frame(unsigned long long ID, size_t size);
+	Frame(unsigned long long ID, uint8_t* data, size_t size);
 
 	/**
 	 * @brief	Class destructor
@@ -43,29 +43,36 @@ public:
 	 */
 	unsigned long long getID() const;
 
+	/**
+	 * @brief	Get the start of the bytes of the frame
+	 * 
+	 * @return	A pointer to the first byte of the frame
+	 */
+	uint8_t* data() const;
+
 	/**
 	 * @brief	Read data from the frame
 	 * 
-	 * @param	frameAddress --
+	 * @param	offset --
 	 *			Determines which address in the frame is
 	 *			going to be read
 	 * 
 	 * @return	Data that was read from the frame
 	 */
-	std::string read(std::string frameAddress);
+	uint8_t read(size_t offset) const;
 
 	/**
 	 * @brief	Write data into one of the addresses of the frame
 	 * 
-	 * @param	frameAddress --
-	 *			Determines etermine which address in the frame the 
+	 * @param	offset --
+	 *			Determines which address in the frame the 
 	 *			data is going to be written in 
 	 * 
 	 * @param	data --
 	 *			The data that is going to be written into the 
 	 *			address location
 	 */
-	void write(std::string frameAddress, std::string data);
+	void write(size_t offset, uint8_t data);
 
 	// ----- || Operators || ----- //
 
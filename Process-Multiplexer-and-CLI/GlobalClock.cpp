@@ -22,7 +22,7 @@ void GlobalClock::clockFunction()
 // ----- << Public Member Function Implementation >> ----- //
 GlobalClock::GlobalClock() : ticks(0), clockRunning(false)
 {
-	clockThread = std::thread(&GlobalClock::clockFunction, this);
+
 }
 
 GlobalClock::~GlobalClock()
@@ -43,6 +43,22 @@ GlobalClock& GlobalClock::getInstance()
 	return globalClock;
 }
 
+void GlobalClock::startClock()
+{
+	std::lock_guard<std::mutex> clockLock(clockMutex);
+
+	// The thread is only started here, a thread started by the
+	// constructor could see clockRunning == false and exit before
+	// the clock was ever started
+	if (clockRunning)
+	{
+		return;
+	}
+
+	clockRunning = true;
+	clockThread = std::thread(&GlobalClock::clockFunction, this);
+}
+
 void GlobalClock::waitForTick()
 {
 	std::unique_lock<std::mutex> clockLock(clockMutex);
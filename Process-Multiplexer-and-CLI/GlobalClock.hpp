@@ -19,7 +19,7 @@ private:
 	std::thread clockThread;
 
 	// Primitive Data Members
-	bool clockRunning;
+	std::atomic<bool> clockRunning;
 
 	/**
 	 * @brief	Clock logic
@@ -56,9 +56,9 @@ public:
 	size_t getTicks() const { return ticks; }
 
 	/**
-	 * @brief	Start the clock
+	 * @brief	Start the clock thread if it is not running yet
 	 */
-	void startClock() { clockRunning = true; };
+	void startClock();
 
 	/**
 	 * @brief	Waits until a tick has passed
@@ -2,7 +2,7 @@
 #include "Instruction_READ.hpp"
 
 // ----- << Implementation >> ----- //
-Instruction_READ::Instruction_READ(std::string memoryLocation, std::string destinationVariable)
+Instruction_READ::Instruction_READ(uint32_t memoryLocation, std::string destinationVariable)
 	: memoryLocation(memoryLocation), destinationVariable(destinationVariable)
 {
 	setInstructionType(READ);
@@ -19,7 +19,7 @@ std::unique_ptr<Instruction> Instruction_READ::clone() const
 	return std::make_unique<Instruction_READ>(*this);
 }
 
-std::string Instruction_READ::getAddress() const
+uint32_t Instruction_READ::getAddress() const
 {
 	return memoryLocation;
 }
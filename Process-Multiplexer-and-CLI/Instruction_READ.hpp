@@ -14,14 +14,14 @@ class Instruction_READ : public Instruction
 {
 private:
 	// User-defined Data Members
-	std::string memoryLocation;
+	uint32_t memoryLocation;
 	std::string destinationVariable;
 public:
 	/**
 	 * @brief	Class constructor
 	 */
 	Instruction_READ(
-		std::string memoryLocation, 
+		uint32_t memoryLocation, 
 		std::string destinationVariable
 	);
 
@@ -40,7 +40,7 @@ public:
 	/**
 	 * @brief	Get the address for the READ instruction
 	 */
-	std::string getAddress() const;
+	uint32_t getAddress() const;
 
 	/**
 	 * @brief	Get the destination variable for the READ
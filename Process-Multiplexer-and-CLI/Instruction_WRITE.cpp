@@ -2,7 +2,7 @@
 #include "Instruction_WRITE.hpp"
 
 // ----- << Implementation >> ----- //
-Instruction_WRITE::Instruction_WRITE(std::string memoryLocation, uint16_t data)
+Instruction_WRITE::Instruction_WRITE(uint32_t memoryLocation, uint16_t data)
 	: memoryLocation(memoryLocation), data(data)
 {
 	setInstructionType(WRITE);
@@ -19,7 +19,7 @@ std::unique_ptr<Instruction> Instruction_WRITE::clone() const
 	return std::make_unique<Instruction_WRITE>(*this);
 }
 
-std::string Instruction_WRITE::getAddress() const
+uint32_t Instruction_WRITE::getAddress() const
 {
 	return memoryLocation;
 }
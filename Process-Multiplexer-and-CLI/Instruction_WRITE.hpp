@@ -15,13 +15,13 @@ class Instruction_WRITE : public Instruction
 private:
 	// User-defined Data Members
 	uint16_t data;
-	std::string memoryLocation;
+	uint32_t memoryLocation;
 
 public:
 	/**
 	 * @brief	Class constructor
 	 */
-	Instruction_WRITE(std::string memoryLocation, uint16_t data);
+	Instruction_WRITE(uint32_t memoryLocation, uint16_t data);
 
 	/**
 	 * @brief	Copy constructor
@@ -40,7 +40,7 @@ public:
 	 * 
 	 * @return	The destination address
 	 */
-	std::string getAddress() const;
+	uint32_t getAddress() const;
 
 	/**
 	 * @brief	Get the data that is going to be written to a 
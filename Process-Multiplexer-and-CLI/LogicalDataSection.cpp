@@ -1,59 +1,56 @@
 // ----- << External Library >> ----- //
 #include "LogicalDataSection.hpp"
+#include <bit>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 
 // ---- << Private Member Function Implementation >> ----- //
-std::string LogicalDataSection::convertDecToHex(size_t dec)
+std::optional<size_t> LogicalDataSection::findSlot(const std::string& identifier) const
 {
-	std::ostringstream stream;
+	size_t mask = index.size() - 1;
 
-	stream << std::hex << std::uppercase;
-	stream << std::setw(4) << std::setfill('0') << dec;
+	// The index is never full, so an empty entry ends the probe
+	for (size_t position = probeStart(identifier); index[position] != 0; position = (position + 1) & mask)
+	{
+		size_t slot = index[position] - 1;
 
-	return stream.str();
+		if (symbols[slot] == identifier)
+		{
+			return slot;
+		}
+	}
+
+	return std::nullopt;
 }
 
-size_t LogicalDataSection::convertHexToDecimal(std::string hex)
+size_t LogicalDataSection::probeStart(const std::string& identifier) const
 {
-	size_t result = 0;
-
-	try
-	{
-		result = std::stoul(hex, nullptr, 16);
-	}
-	catch (const std::invalid_argument& e)
-	{
-		throw std::runtime_error("Invalid Hex String: " + hex);
-	}
-	catch (const std::out_of_range& e)
-	{
-		throw std::runtime_error("Hex String out of range: " + hex);
-	}
-
-	return result;
+	return std::hash<std::string>{}(identifier) & (index.size() - 1);
 }
 
 // ----- << Public Member Function Implementation >> ----- //
 LogicalDataSection::LogicalDataSection(size_t numberOfVariables)
-	: maximumVariables(numberOfVariables)
+	: maximumVariables(numberOfVariables), occupied(0),
+	symbols(numberOfVariables), values(numberOfVariables, 0),
+	index(std::bit_ceil(numberOfVariables * 2 + 1), 0)
 {
-	for (size_t i = 0; i < numberOfVariables; i++)
-	{
-		std::ostringstream stream;
-		stream << std::hex << std::uppercase
-			<< std::setw(5) << std::setfill('0') << (i * 2);
-		std::string address = stream.str();
 
-		data[address] = std::nullopt;
-	}
 }
 
 LogicalDataSection::~LogicalDataSection() = default;
 
+LogicalDataSection::LogicalDataSection(const LogicalDataSection& source)
+	: maximumVariables(source.maximumVariables), occupied(source.occupied),
+	symbols(source.symbols), values(source.values), index(source.index)
+{
+
+}
+
 LogicalDataSection::LogicalDataSection(LogicalDataSection&& source) noexcept
-	: data(std::move(source.data)), maximumVariables(source.maximumVariables)
+	: maximumVariables(source.maximumVariables), occupied(source.occupied),
+	symbols(std::move(source.symbols)), values(std::move(source.values)), index(std::move(source.index))
 {
 
 }
@@ -62,101 +59,113 @@ LogicalDataSection& LogicalDataSection::operator=(LogicalDataSection&& source) n
 {
 	if (this != &source)
 	{
-		data = std::move(source.data);
+		maximumVariables = source.maximumVariables;
+		occupied = source.occupied;
+		symbols = std::move(source.symbols);
+		values = std::move(source.values);
+		index = std::move(source.index);
 	}
 
 	return *this;
 }
 
-std::optional<uint16_t> LogicalDataSection::getData(std::string identifier)
+bool LogicalDataSection::contains(const std::string& identifier) const
+{
+	return findSlot(identifier).has_value();
+}
+
+std::optional<uint16_t> LogicalDataSection::getData(const std::string& identifier)
 {
-	for (const auto& [key, value] : data)
+	std::optional<size_t> slot = findSlot(identifier);
+
+	if (slot)
 	{
-		if (value)
-		{
-			if (value->first == identifier)
-			{
-				return value->second;
-			}
-		}
+		return values[*slot];
 	}
 
 	return std::nullopt;
 }
 
-std::optional<std::string> LogicalDataSection::getVariableAddress(std::string identifier)
+std::optional<std::string> LogicalDataSection::getVariableAddress(const std::string& identifier)
 {
-	for (const auto& [key, value] : data)
+	std::optional<size_t> slot = findSlot(identifier);
+
+	if (!slot)
 	{
-		if (value)
-		{
-			if (value->first == identifier)
-			{
-				return key;
-			}
-		}
+		return std::nullopt;
 	}
 
-	return std::nullopt;
-}
+	// Same 5 digit form the addresses have always been printed in
+	static const char digits[] = "0123456789ABCDEF";
+	size_t address = *slot * 2;
+	std::string hex(5, '0');
 
-bool LogicalDataSection::insertVariable(std::string identifier)
-{
-	if (!isFull())
+	for (size_t i = 0; i < hex.size(); i++)
 	{
-		for (auto& [key, value] : data)
-		{
-			if (!value) // if null
-			{
-				value = { identifier , 0 };
-				return true;
-			}
-		}
+		hex[hex.size() - 1 - i] = digits[(address >> (i * 4)) & 0xF];
 	}
 
-	return false;
+	return hex;
 }
 
-bool LogicalDataSection::isFull()
+bool LogicalDataSection::insertVariable(const std::string& identifier)
 {
-	for (const auto& [key, value] : data)
+	size_t mask = index.size() - 1;
+	size_t position = probeStart(identifier);
+
+	for (; index[position] != 0; position = (position + 1) & mask)
 	{
-		if (!value) // if null
+		if (symbols[index[position] - 1] == identifier)
 		{
-			return false;
+			return true;
 		}
 	}
 
+	if (isFull())
+	{
+		return false;
+	}
+
+	symbols[occupied] = identifier;
+	values[occupied] = 0;
+	index[position] = static_cast<uint16_t>(occupied + 1);
+	occupied++;
+
 	return true;
 }
 
+bool LogicalDataSection::isFull() const
+{
+	return occupied == maximumVariables;
+}
+
 void LogicalDataSection::print()
 {
-	for (const auto& [key, value] : data)
+	for (size_t slot = 0; slot < maximumVariables; slot++)
 	{
-		if (value)
+		std::ostringstream stream;
+		stream << std::hex << std::uppercase
+			<< std::setw(5) << std::setfill('0') << (slot * 2);
+
+		if (slot < occupied)
 		{
-			std::cout << key << " | " << value->first << " -> " << value->second << "\n";
+			std::cout << stream.str() << " | " << symbols[slot] << " -> " << values[slot] << "\n";
 		}
 		else
 		{
-			std::cout << key << " | " << "free\n";
+			std::cout << stream.str() << " | " << "free\n";
 		}
 	}
 }
 
-bool LogicalDataSection::setValue(std::string identifier, uint16_t varibaleValue)
+bool LogicalDataSection::setValue(const std::string& identifier, uint16_t varibaleValue)
 {
-	for (auto& [key, value] : data)
+	std::optional<size_t> slot = findSlot(identifier);
+
+	if (slot)
 	{
-		if (value)
-		{
-			if (value->first == identifier)
-			{
-				value->second = varibaleValue;
-				return true;
-			}
-		}
+		values[*slot] = varibaleValue;
+		return true;
 	}
 
 	return false;
@@ -1,48 +1,61 @@
 #pragma once
 
 // ----- << External Library >> ----- //
-#include <map>
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <vector>
 
 // ----- << Class >> ----- //
 
 /**
  * @brief	A class that emulates the data section of a process 
  *			which are mainly initialized and unitialized variables
+ * 
+ *			Variables take slots in insertion order, slot i is at
+ *			address i * 2. Identifiers are found through a fixed
+ *			open-addressing index of slots, so a lookup is a hash
+ *			and a short probe instead of a scan of every slot
  */
 class LogicalDataSection
 {
 private:
 	// User-defined Data Members
 	size_t maximumVariables;
-	std::map<std::string, std::optional
-		<std::pair<std::string, uint16_t>>
-	> data;
-			// Address - variable identifier
+	size_t occupied;
+			// Slots in use, the first occupied slots are the ones
+			// taken
+
+	std::vector<std::string> symbols;
+	std::vector<uint16_t> values;
+			// Identifier and value of each slot
+
+	std::vector<uint16_t> index;
+			// Open-addressing table of slot + 1, 0 is empty. Its
+			// size is a power of 2 at least twice maximumVariables
+			// and nothing is erased, so probes are short and end
 
 	/**
-	 * @brief	Conversts a decimal number to a hexadecimal string
-	 *
-	 * @param	dec --
-	 *			The number that is being converted
-	 *
-	 * @return	An equivalent hexadecimal string representation of
-	 *			the decimal number
+	 * @brief	Finds the slot of a variable
+	 * 
+	 * @param	identifier --
+	 *			The identifier of the variable
+	 * 
+	 * @return	The slot of the variable if it exists. Otherwise,
+	 *			null.
 	 */
-	std::string convertDecToHex(size_t dec);
+	std::optional<size_t> findSlot(const std::string& identifier) const;
 
 	/**
-	 * @brief	Converts a string of hexadecmial numbers to a
-	 *			decimal number
-	 *
-	 * @param	hex --
-	 *			The string of hexadecimal characters is being
-	 *			converted
-	 *
-	 * @return	Decimal equivalent of the hexadecimal string
+	 * @brief	Get the first entry of the index probed for an
+	 *			identifier
+	 * 
+	 * @param	identifier --
+	 *			The identifier being looked up
+	 * 
+	 * @return	The position in index where probing starts
 	 */
-	size_t convertHexToDecimal(std::string hex);
+	size_t probeStart(const std::string& identifier) const;
 
 public:
 	/**
@@ -56,9 +69,9 @@ public:
 	~LogicalDataSection();
 
 	/**
-	 * @brief	Copy constructor (deleted)
+	 * @brief	Copy constructor, used when a process is forked
 	 */
-	LogicalDataSection(const LogicalDataSection&) = delete;
+	LogicalDataSection(const LogicalDataSection& source);
 
 	/**
 	 * @brief	Copy assignment operator (deleted)
@@ -77,6 +90,16 @@ public:
 	LogicalDataSection& 
 		operator=(LogicalDataSection&& source) noexcept;
 
+	/**
+	 * @brief	Checks if a variable is in the data section
+	 * 
+	 * @param	identifier --
+	 *			The identifier of the variable
+	 * 
+	 * @return	true if the variable exists. Otherwise, false.
+	 */
+	bool contains(const std::string& identifier) const;
+
 	/**
 	 * @brief	Get the value assigned to a variable given
 	 *			its identifier
@@ -87,7 +110,7 @@ public:
 	 * 
 	 * @return	The data that the variable stores
 	 */
-	std::optional<uint16_t> getData(std::string identifier);
+	std::optional<uint16_t> getData(const std::string& identifier);
 
 	/**
 	 * @brief	Get the address for a variable
@@ -101,7 +124,7 @@ public:
 	 *			section. Otherwise, null.
 	 */
 	std::optional<std::string> getVariableAddress(
-		std::string identifier
+		const std::string& identifier
 	);
 
 	/**
@@ -111,16 +134,17 @@ public:
 	 *			The identifier being assigned to a variabled
 	 * 
 	 * @return	true if variable is successfully inserted into
-	 *			the data section. Otherwise, false.
+	 *			the data section, or is already in it. Otherwise,
+	 *			false.
 	 */
-	bool insertVariable(std::string identifier);
+	bool insertVariable(const std::string& identifier);
 
 	/**
 	 * @brief	Checks if the data section is full
 	 *
 	 * @return	true if the data section is full. Otherwise, false.
 	 */
-	bool isFull();
+	bool isFull() const;
 
 	/**
 	 * @brief	Prints the contents of the logical data section
@@ -139,5 +163,5 @@ public:
 	 * @return	true if the operation is successful.
 	 *			Otherwise, false.
 	 */
-	bool setValue(std::string identifier, uint16_t value);
+	bool setValue(const std::string& identifier, uint16_t value);
 };
\ No newline at end of file
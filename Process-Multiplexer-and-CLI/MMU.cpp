@@ -1,156 +1,1261 @@
 // ----- << External Library >> ----- //
 #include "MMU.hpp"
+#include "TLB.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
 
+// ----- << Static Functions >> ----- //
+static std::optional<uint8_t> hexDigit(char character)
+{
+	if (character >= '0' && character <= '9')
+	{
+		return static_cast<uint8_t>(character - '0');
+	}
+
+	if (character >= 'A' && character <= 'F')
+	{
+		return static_cast<uint8_t>(character - 'A' + 10);
+	}
+
+	return std::nullopt;
+}
+
 // ----- << Private Member Function Implementation >> ----- //
-std::vector<std::string> MMU::dataFormat(std::string raw)
+void MMU::copyOnWrite(PageTable& table, unsigned long long processID, size_t pageIndex)
+{
+	Page& page = *findPage(table, pageIndex);
+	std::optional<unsigned long long> sharedID = physicalMemory.getFrameID(page.slot);
+	std::vector<uint8_t> data(memoryPerFrame);
+
+	if (!sharedID || !physicalMemory.copyFrame(*sharedID, data.data()))
+	{
+		return;
+	}
+
+	// May evict the shared frame itself, which unshares the page
+	std::optional<size_t> slot = obtainSlot(table);
+
+	if (!slot)
+	{
+		return;
+	}
+
+	// The private copy is the only place the contents of an
+	// inherited page are kept, so it starts dirty
+	bool inherited = page.inherited;
+
+	if (page.shared)
+	{
+		page.inherited = false;
+		unshare(table, processID, pageIndex);
+	}
+
+	page.frameID = table.firstFrameID + pageIndex;
+
+	physicalMemory.loadFrame(page.frameID, *slot, 1, data.data());
+	page.valid = true;
+	page.slot = *slot;
+	invertedTable[page.frameID] = { processID, pageIndex };
+	pinFrame(table, *slot);
+
+	if (inherited)
+	{
+		setDirty(page, true);
+	}
+
+	// TLB entries still point at the shared slot
+	shootdown(table);
+
+	copyOnWrites++;
+}
+
+void MMU::faultIn(PageTable& table, unsigned long long processID, size_t requestedPage)
+{
+	if (table.directory[requestedPage / pagesPerTable].huge)
+	{
+		faultInHuge(table, processID, requestedPage - requestedPage % pagesPerTable);
+		return;
+	}
+
+	Page& page = getPage(table, requestedPage);
+
+	if (page.frameID == static_cast<unsigned long long>(-1))
+	{
+		page.frameID = table.firstFrameID + requestedPage;
+	}
+
+	if (page.valid)
+	{
+		return;
+	}
+
+	pageFaults++;
+
+	// Grow the window while faults stay sequential
+	if (requestedPage == table.nextSequential && requestedPage != 0)
+	{
+		table.readAhead = std::min(readAheadWindow, std::max<size_t>(1, table.readAhead * 2));
+	}
+	else
+	{
+		table.readAhead = 0;
+	}
+
+	// Never read ahead more than a quarter of physical memory
+	size_t window = std::min(table.readAhead, maximumOverallMemory / memoryPerFrame / 4);
+	size_t count = 1;
+	bool anyBacked = page.backed;
+
+	while (count <= window && requestedPage + count < table.numPages)
+	{
+		// Read-ahead stays in base pages
+		if (table.directory[(requestedPage + count) / pagesPerTable].huge)
+		{
+			break;
+		}
+
+		Page& next = getPage(table, requestedPage + count);
+
+		if (next.valid)
+		{
+			break;
+		}
+
+		anyBacked = anyBacked || next.backed;
+		count++;
+	}
+
+	table.nextSequential = requestedPage + count;
+
+	std::vector<uint8_t> buffer;
+
+	if (anyBacked)
+	{
+		buffer.resize(count * memoryPerFrame);
+		physicalMemory.readBackingStore(table.firstFrameID + requestedPage, count, buffer.data());
+	}
+
+	// The requested page is loaded first. A policy that evicts the
+	// least used frame first (LFU, ARC) may pick a page of the batch
+	// as the victim, which ends the read-ahead there
+	for (size_t i = 0; i < count; i++)
+	{
+		Page& target = getPage(table, requestedPage + i);
+		std::optional<size_t> slot = obtainSlot(table, table.firstFrameID + requestedPage, i);
+
+		if (!slot)
+		{
+			table.nextSequential = requestedPage + i;
+			return;
+		}
+
+		target.frameID = table.firstFrameID + requestedPage + i;
+
+		loadPage(target, *slot, anyBacked && target.backed ? buffer.data() + i * memoryPerFrame : nullptr);
+		target.slot = *slot;
+		invertedTable[target.frameID] = { processID, requestedPage + i };
+		pinFrame(table, *slot);
+
+		pagesIn++;
+	}
+}
+
+void MMU::faultInHuge(PageTable& table, unsigned long long processID, size_t requestedPage)
+{
+	Page& page = getPage(table, requestedPage);
+
+	if (page.valid)
+	{
+		return;
+	}
+
+	pageFaults++;
+
+	page.frameID = table.firstFrameID + requestedPage;
+
+	std::optional<size_t> slot = obtainRun(table);
+
+	if (!slot)
+	{
+		return;
+	}
+
+	// The frame IDs of the huge page are consecutive, so it is read
+	// in one run
+	if (page.backed)
+	{
+		std::vector<uint8_t> buffer(pagesPerTable * memoryPerFrame);
+
+		physicalMemory.readBackingStore(page.frameID, pagesPerTable, buffer.data());
+		physicalMemory.loadFrame(page.frameID, *slot, pagesPerTable, buffer.data());
+	}
+	else
+	{
+		physicalMemory.updateZeroFrame(page.frameID, *slot, pagesPerTable);
+	}
+
+	page.valid = true;
+	page.slot = *slot;
+	invertedTable[page.frameID] = { processID, requestedPage };
+	pinFrame(table, *slot);
+
+	pagesIn += pagesPerTable;
+}
+
+MMU::Page* MMU::findPage(PageTable& table, size_t pageIndex)
+{
+	DirectoryEntry& entry = table.directory[pageIndex / pagesPerTable];
+
+	if (!entry.pages)
+	{
+		return nullptr;
+	}
+
+	return entry.huge ? &entry.pages[0] : &entry.pages[pageIndex % pagesPerTable];
+}
+
+std::shared_ptr<MMU::PageTable> MMU::findTable(unsigned long long processID)
+{
+	Shard& shard = masterTable[processID % numShards];
+	std::unique_lock<std::mutex> shardLock(shard.mutex);
+
+	auto table = shard.tables.find(processID);
+
+	if (table == shard.tables.end())
+	{
+		return nullptr;
+	}
+
+	return table->second;
+}
+
+MMU::Page& MMU::getPage(PageTable& table, size_t pageIndex)
+{
+	DirectoryEntry& entry = table.directory[pageIndex / pagesPerTable];
+
+	if (!entry.pages)
+	{
+		size_t entries = entry.huge ? 1 : pagesPerTable;
+
+		entry.pages = std::make_unique<Page[]>(entries);
+		entry.pages[0].huge = entry.huge;
+		pageTableMemory += entries * sizeof(Page);
+	}
+
+	return entry.huge ? entry.pages[0] : entry.pages[pageIndex % pagesPerTable];
+}
+
+size_t MMU::getPageIndex(unsigned long long frameID)
+{
+	auto owner = invertedTable.find(frameID);
+
+	if (owner != invertedTable.end())
+	{
+		return owner->second.second;
+	}
+
+	return 0;
+}
+
+size_t MMU::getSlot(const Page& page, size_t pageIndex) const
+{
+	return page.huge ? page.slot + pageIndex % pagesPerTable : page.slot;
+}
+
+void MMU::loadPage(Page& page, size_t index, const uint8_t* data)
+{
+	if (page.backed && data)
+	{
+		physicalMemory.loadFrame(page.frameID, index, 1, data);
+	}
+	else if (page.backed)
+	{
+		physicalMemory.updateFrame(page.frameID, index);
+	}
+	else
+	{
+		physicalMemory.updateZeroFrame(page.frameID, index, 1);
+	}
+
+	page.valid = true;
+}
+
+void MMU::flushDirtyFrames()
+{
+	std::vector<std::pair<unsigned long long, std::vector<uint8_t>>> batch;
+	std::unique_lock<std::mutex> evictionLock(evictionMutex);
+
+	size_t numFrames = maximumOverallMemory / memoryPerFrame;
+
+	for (const auto& [frameID, owner] : invertedTable)
+	{
+		if (numFrames - dirtyFrames >= cleanHighWatermark)
+		{
+			break;
+		}
+
+		std::shared_ptr<PageTable> table = findTable(owner.first);
+
+		if (!table)
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> tableLock(table->mutex);
+		Page* page = findPage(*table, owner.second);
+
+		if (!page || !page->dirty)
+		{
+			continue;
+		}
+
+		std::vector<uint8_t> data(memoryPerFrame * (page->huge ? pagesPerTable : 1));
+
+		if (!physicalMemory.copyFrame(frameID, data.data()))
+		{
+			continue;
+		}
+
+		setDirty(*page, false);
+		page->backed = true;
+
+		batch.emplace_back(frameID, std::move(data));
+		asyncWriteBacks++;
+	}
+
+	if (batch.empty())
+	{
+		return;
+	}
+
+	std::unique_lock<std::recursive_mutex> backingStoreLock = physicalMemory.lockBackingStore();
+	evictionLock.unlock();
+
+	for (const auto& [frameID, data] : batch)
+	{
+		physicalMemory.writeBackingStore(frameID, data.size() / memoryPerFrame, data.data());
+	}
+}
+
+void MMU::flusherFunction()
+{
+	size_t numFrames = maximumOverallMemory / memoryPerFrame;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> flusherLock(flusherMutex);
+
+			flusherCondition.wait_for(flusherLock, std::chrono::milliseconds(50), [this, numFrames] {
+				return !flusherRunning || numFrames - dirtyFrames < cleanLowWatermark;
+			});
+
+			if (!flusherRunning)
+			{
+				return;
+			}
+
+			if (numFrames - dirtyFrames >= cleanLowWatermark)
+			{
+				continue;
+			}
+		}
+
+		flushDirtyFrames();
+	}
+}
+
+uint64_t MMU::hashFrame(const uint8_t* data) const
+{
+	uint64_t hash = 0xCBF29CE484222325;
+
+	for (size_t i = 0; i < memoryPerFrame; i++)
+	{
+		hash ^= data[i];
+		hash *= 0x100000001B3;
+	}
+
+	return hash;
+}
+
+void MMU::mergeFrames()
+{
+	std::unique_lock<std::mutex> evictionLock(evictionMutex);
+
+	std::unordered_map<uint64_t, unsigned long long> candidates;
+			// Hash, Frame ID of the first frame seen with it
+
+	for (const auto& [frameID, shared] : sharedFrames)
+	{
+		candidates.emplace(shared.hash, frameID);
+	}
+
+	// Merging erases from invertedTable, so walk a copy
+	std::vector<std::pair<unsigned long long, std::pair<unsigned long long, size_t>>> resident(invertedTable.begin(), invertedTable.end());
+	std::vector<uint8_t> data(memoryPerFrame);
+	std::vector<uint8_t> other(memoryPerFrame);
+
+	for (const auto& [frameID, owner] : resident)
+	{
+		std::shared_ptr<PageTable> table = findTable(owner.first);
+
+		if (!table)
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> tableLock(table->mutex);
+		Page* found = findPage(*table, owner.second);
+
+		// Huge pages are never merged
+		if (!found || found->huge || !found->valid || found->dirty || found->shared || !physicalMemory.copyFrame(frameID, data.data()))
+		{
+			continue;
+		}
+
+		Page& page = *found;
+
+		uint64_t hash = hashFrame(data.data());
+		auto candidate = candidates.find(hash);
+
+		if (candidate == candidates.end())
+		{
+			candidates.emplace(hash, frameID);
+			continue;
+		}
+
+		auto shared = sharedFrames.find(candidate->second);
+
+		if (shared == sharedFrames.end())
+		{
+			// The first frame is still private, check that it is 
+			// still clean and the same before it becomes shared
+			auto candidateOwner = invertedTable.find(candidate->second);
+
+			if (candidateOwner == invertedTable.end())
+			{
+				candidate->second = frameID;
+				continue;
+			}
+
+			std::shared_ptr<PageTable> candidateTable = findTable(candidateOwner->second.first);
+			std::unique_lock<std::mutex> candidateLock(candidateTable->mutex, std::defer_lock);
+
+			if (candidateTable != table)
+			{
+				candidateLock.lock();
+			}
+
+			Page& candidatePage = *findPage(*candidateTable, candidateOwner->second.second);
+
+			if (!candidatePage.valid || candidatePage.dirty || candidatePage.shared ||
+				!physicalMemory.copyFrame(candidate->second, other.data()) || other != data)
+			{
+				candidate->second = frameID;
+				continue;
+			}
+
+			shared = shareFrame(*candidateTable, candidateOwner->second.first, candidateOwner->second.second, hash);
+			candidate->second = shared->first;
+		}
+		else if (!physicalMemory.copyFrame(shared->first, other.data()) || other != data)
+		{
+			continue;
+		}
+
+		std::optional<size_t> sharedSlot = physicalMemory.find(shared->first);
+
+		if (!sharedSlot)
+		{
+			continue;
+		}
+
+		// Map the page onto the shared frame and free its own
+		releasePin(*table, page.slot);
+		physicalMemory.remove({ frameID });
+		invertedTable.erase(frameID);
+		availableMemory += memoryPerFrame;
+
+		page.slot = *sharedSlot;
+		page.shared = true;
+		table->sharedSlots[*sharedSlot]++;
+		shared->second.sharers.push_back(owner);
+
+		// Before evictionMutex is released, so the freed slot is
+		// not reused while a TLB entry still points at it
+		shootdown(*table);
+
+		mergedPages++;
+	}
+}
+
+void MMU::mergerFunction()
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> mergerLock(mergerMutex);
+
+			mergerCondition.wait_for(mergerLock, std::chrono::milliseconds(100), [this] {
+				return !mergerRunning;
+			});
+
+			if (!mergerRunning)
+			{
+				return;
+			}
+		}
+
+		mergeFrames();
+	}
+}
+
+size_t MMU::nextPage(const PageTable& table, size_t pageIndex) const
+{
+	const DirectoryEntry& entry = table.directory[pageIndex / pagesPerTable];
+
+	if (entry.huge || !entry.pages)
+	{
+		return (pageIndex / pagesPerTable + 1) * pagesPerTable;
+	}
+
+	return pageIndex + 1;
+}
+
+std::optional<unsigned long long> MMU::evictSlot(size_t victimKey, PageTable& faultingTable)
+{
+	std::optional<unsigned long long> victimFrameID = physicalMemory.getFrameID(victimKey);
+
+	if (!victimFrameID)
+	{
+		return std::nullopt;
+	}
+
+	auto shared = sharedFrames.find(*victimFrameID);
+
+	if (shared != sharedFrames.end())
+	{
+		// Every sharer is clean, so invalidating them is enough,
+		// except that inherited sharers save the contents first
+		std::vector<uint8_t> data;
+
+		for (const auto& [processID, pageIndex] : shared->second.sharers)
+		{
+			std::shared_ptr<PageTable> sharerTable = findTable(processID);
+			std::unique_lock<std::mutex> sharerLock(sharerTable->mutex, std::defer_lock);
+
+			if (sharerTable.get() != &faultingTable)
+			{
+				sharerLock.lock();
+			}
+
+			Page& sharerPage = *findPage(*sharerTable, pageIndex);
+
+			if (sharerPage.inherited)
+			{
+				if (data.empty())
+				{
+					data.resize(memoryPerFrame);
+					physicalMemory.copyFrame(*victimFrameID, data.data());
+				}
+
+				physicalMemory.writeBackingStore(sharerPage.frameID, 1, data.data());
+				sharerPage.backed = true;
+				sharerPage.inherited = false;
+				syncWriteBacks++;
+			}
+
+			sharerPage.shared = false;
+			sharerPage.valid = false;
+			shootdown(*sharerTable);
+
+			if (--sharerTable->sharedSlots[victimKey] == 0)
+			{
+				sharerTable->sharedSlots.erase(victimKey);
+			}
+		}
+
+		mergedPages -= shared->second.sharers.size();
+		sharedFrameCount--;
+		sharedFrames.erase(shared);
+
+		pagesOut++;
+
+		return victimFrameID;
+	}
+
+	auto owner = invertedTable.find(*victimFrameID);
+	std::shared_ptr<PageTable> victimTable = owner != invertedTable.end() ? findTable(owner->second.first) : nullptr;
+
+	if (victimTable)
+	{
+		// The faulting table is already locked by the caller
+		std::unique_lock<std::mutex> victimLock(victimTable->mutex, std::defer_lock);
+
+		if (victimTable.get() != &faultingTable)
+		{
+			victimLock.lock();
+		}
+
+		Page& victimPage = *findPage(*victimTable, owner->second.second);
+
+		if (victimPage.dirty)
+		{
+			physicalMemory.overwriteBackingStore(victimKey);
+			victimPage.backed = true;
+			setDirty(victimPage, false);
+			syncWriteBacks++;
+		}
+
+		victimPage.valid = false;
+		releasePin(*victimTable, victimKey);
+
+		// After the page is invalid and before the slot is reused,
+		// so a TLB entry filled meanwhile is caught
+		shootdown(*victimTable);
+	}
+
+	if (owner != invertedTable.end())
+	{
+		invertedTable.erase(owner);
+	}
+
+	pagesOut += physicalMemory.getSpan(victimKey);
+
+	return victimFrameID;
+}
+
+std::optional<size_t> MMU::obtainRun(PageTable& faultingTable)
+{
+	std::optional<size_t> run = physicalMemory.findFreeRun(pagesPerTable);
+
+	if (!run)
+	{
+		// Huge frames are aligned like the run, so emptying the run
+		// of the victim never splits a frame
+		size_t victimKey = physicalMemory.getVictimKey();
+		size_t first = victimKey - victimKey % pagesPerTable;
+		std::vector<unsigned long long> rmVector;
+
+		for (size_t i = first; i < first + pagesPerTable; i += std::max<size_t>(1, physicalMemory.getSpan(i)))
+		{
+			std::optional<unsigned long long> victimFrameID = evictSlot(i, faultingTable);
+
+			if (victimFrameID)
+			{
+				rmVector.push_back(*victimFrameID);
+			}
+		}
+
+		availableMemory += physicalMemory.remove(rmVector) * memoryPerFrame;
+		run = first;
+	}
+
+	availableMemory -= pagesPerTable * memoryPerFrame;
+
+	return run;
+}
+
+std::optional<size_t> MMU::obtainSlot(PageTable& faultingTable)
+{
+	return obtainSlot(faultingTable, 0, 0);
+}
+
+std::optional<size_t> MMU::obtainSlot(PageTable& faultingTable, unsigned long long batchFrameID, size_t batchCount)
+{
+	std::optional<size_t> freeKey = physicalMemory.findFreeFrame();
+
+	if (freeKey)
+	{
+		availableMemory -= memoryPerFrame;
+		return freeKey;
+	}
+
+	size_t victimKey = physicalMemory.getVictimKey();
+	std::optional<unsigned long long> victimFrameID = physicalMemory.getFrameID(victimKey);
+
+	if (victimFrameID && *victimFrameID - batchFrameID < batchCount)
+	{
+		physicalMemory.restoreVictim(victimKey);
+		return std::nullopt;
+	}
+
+	if (!evictSlot(victimKey, faultingTable))
+	{
+		std::cerr << "\nError: Victim Frame not in memory\n";
+		return std::nullopt;
+	}
+
+	// The slot is reused, the rest of a huge victim is freed when
+	// it is
+	availableMemory += (physicalMemory.getSpan(victimKey) - 1) * memoryPerFrame;
+
+	return victimKey;
+}
+
+void MMU::pinFrame(PageTable& table, size_t slot)
+{
+	size_t span = physicalMemory.getSpan(slot);
+
+	if (table.pinned + span > table.reservation)
+	{
+		return;
+	}
+
+	physicalMemory.pin(slot);
+	table.pinned += span;
+}
+
+bool MMU::releasePin(PageTable& table, size_t slot)
+{
+	if (!physicalMemory.isPinned(slot))
+	{
+		return false;
+	}
+
+	table.pinned -= physicalMemory.getSpan(slot);
+
+	return true;
+}
+
+void MMU::fillTLB(TLB& tlb, std::shared_ptr<PageTable> table, unsigned long long processID, size_t pageIndex)
+{
+	Page* page = pageIndex < table->numPages ? findPage(*table, pageIndex) : nullptr;
+
+	if (!page || !page->valid)
+	{
+		return;
+	}
+
+	// A hit skips the limit check, so only cache pages that are
+	// entirely inside the limit
+	if ((pageIndex + 1) * memoryPerFrame > table->limit)
+	{
+		return;
+	}
+
+	TLB::Entry entry;
+	entry.epoch = table->shootdownEpoch;
+	entry.processID = processID;
+	entry.pageIndex = pageIndex;
+	entry.slot = getSlot(*page, pageIndex);
+	entry.table = table;
+
+	tlb.insert(entry);
+}
+
+void MMU::reference(PageTable& table, size_t pageIndex)
+{
+	size_t window = ++table.references / workingSetWindow + 1;
+
+	if (window != table.window)
+	{
+		// A window is only skipped when the process made no other
+		// reference through the page table in it
+		table.previousPages = window == table.window + 1 ? table.referencedPages : 0;
+		table.referencedPages = 0;
+		table.window = window;
+
+		setWorkingSetSize(table, table.previousPages);
+	}
+
+	Page& page = getPage(table, pageIndex);
+
+	if (page.referencedWindow == window)
+	{
+		return;
+	}
+
+	// The working set is in frames, a huge page counts all of its
+	page.referencedWindow = window;
+	table.referencedPages += page.huge ? pagesPerTable : 1;
+
+	if (table.referencedPages > table.workingSetSize)
+	{
+		setWorkingSetSize(table, table.referencedPages);
+	}
+}
+
+void MMU::setWorkingSetSize(PageTable& table, size_t size)
+{
+	if (!table.suspended)
+	{
+		activeWorkingSet += size;
+		activeWorkingSet -= table.workingSetSize;
+	}
+
+	table.workingSetSize = size;
+}
+
+void MMU::setDirty(Page& page, bool dirty)
+{
+	if (page.dirty == dirty)
+	{
+		return;
+	}
+
+	page.dirty = dirty;
+
+	size_t frames = page.huge ? pagesPerTable : 1;
+
+	if (!dirty)
+	{
+		dirtyFrames -= frames;
+		return;
+	}
+
+	dirtyFrames += frames;
+
+	if (maximumOverallMemory / memoryPerFrame - dirtyFrames < cleanLowWatermark)
+	{
+		flusherCondition.notify_one();
+	}
+}
+
+std::unordered_map<unsigned long long, MMU::SharedFrame>::iterator MMU::shareFrame(PageTable& table, unsigned long long processID, size_t pageIndex, uint64_t hash)
 {
-	for (char character : raw)
+	Page& page = *findPage(table, pageIndex);
+
+	// The frame keeps its slot and data under an ID that no page
+	// owns
+	unsigned long long sharedID = framesCreated.fetch_add(1);
+
+	// A shared frame is held by no reservation
+	if (releasePin(table, page.slot))
 	{
-		if (!std::isdigit(character) && !(character >= 'A' && character <= 'F'))
-		{
-			throw std::runtime_error("\nERROR: Invalid characters found in raw string\n");
-		}
+		physicalMemory.unpin(page.slot);
 	}
 
-	if (raw.size() % 2 != 0)
+	physicalMemory.renameFrame(page.frameID, sharedID);
+	invertedTable.erase(page.frameID);
+
+	auto shared = sharedFrames.emplace(sharedID, SharedFrame()).first;
+	shared->second.hash = hash;
+	shared->second.sharers.push_back({ processID, pageIndex });
+
+	if (page.dirty)
 	{
-		raw.insert(raw.begin(), '0');
+		setDirty(page, false);
+		page.inherited = true;
 	}
 
-	std::vector<std::string> formatted;
+	page.shared = true;
+	table.sharedSlots[page.slot]++;
 
-	for (size_t i = 0; i < raw.size(); i += 2)
+	mergedPages++;
+	sharedFrameCount++;
+
+	return shared;
+}
+
+void MMU::releaseTables(PageTable& table)
+{
+	for (DirectoryEntry& entry : table.directory)
 	{
-		formatted.push_back(raw.substr(i, 2));
+		if (entry.pages)
+		{
+			pageTableMemory -= (entry.huge ? 1 : pagesPerTable) * sizeof(Page);
+			entry.pages.reset();
+		}
 	}
+}
 
-	return formatted;
+void MMU::shootdown(PageTable& table)
+{
+	table.shootdownEpoch++;
 }
 
-MMU::Page* MMU::getPage(unsigned long long ID)
+void MMU::swapOut(PageTable& table, unsigned long long processID)
 {
-	for (auto pair = masterTable.begin(); pair != masterTable.end(); pair++)
+	std::vector<unsigned long long> rmVector;
+	bool unshared = false;
+
+	// Only the pages resident now are the ones to bring back
+	table.swappedPages.clear();
+
+	for (size_t i = 0; i < table.numPages; i = nextPage(table, i))
 	{
-		for (Page& p : pair->second.pages)
+		Page* page = findPage(table, i);
+
+		if (!page || !page->valid)
 		{
-			if (p.frameID == ID)
-			{
-				return &p;
-			}
+			continue;
+		}
+
+		if (page->shared)
+		{
+			unshare(table, processID, i);
+			unshared = true;
+			continue;
+		}
+
+		// Page order keeps the writes sequential in the backing store
+		if (page->dirty)
+		{
+			physicalMemory.overwriteBackingStore(page->slot);
+			page->backed = true;
+			setDirty(*page, false);
 		}
+
+		page->valid = false;
+		rmVector.push_back(page->frameID);
+		invertedTable.erase(page->frameID);
+		releasePin(table, page->slot);
+		table.swappedPages.push_back(i);
+	}
+
+	if (rmVector.empty() && !unshared)
+	{
+		return;
 	}
 
-	return nullptr;
+	shootdown(table);
+
+	size_t removed = physicalMemory.remove(rmVector);
+
+	availableMemory += removed * memoryPerFrame;
+	pagesOut += removed;
 }
 
-size_t MMU::getPageIndex(unsigned long long frameID)
+void MMU::unshare(PageTable& table, unsigned long long processID, size_t pageIndex)
 {
-	for (auto pair = masterTable.begin(); pair != masterTable.end(); pair++)
+	Page& page = *findPage(table, pageIndex);
+	std::optional<unsigned long long> sharedID = physicalMemory.getFrameID(page.slot);
+	auto shared = sharedID ? sharedFrames.find(*sharedID) : sharedFrames.end();
+
+	if (page.inherited && sharedID)
 	{
-		PageTable table = pair->second;
-		for (size_t i = 0; i < table.pages.size(); i++)
+		std::vector<uint8_t> data(memoryPerFrame);
+
+		if (physicalMemory.copyFrame(*sharedID, data.data()))
 		{
-			if (table.pages[i].frameID == frameID)
-			{
-				return i;
-			}
+			physicalMemory.writeBackingStore(page.frameID, 1, data.data());
+			page.backed = true;
+			syncWriteBacks++;
 		}
 	}
 
-	return 0;
+	page.inherited = false;
+	page.shared = false;
+	page.valid = false;
+
+	if (--table.sharedSlots[page.slot] == 0)
+	{
+		table.sharedSlots.erase(page.slot);
+	}
+
+	if (shared == sharedFrames.end())
+	{
+		return;
+	}
+
+	auto& sharers = shared->second.sharers;
+	sharers.erase(std::find(sharers.begin(), sharers.end(), std::make_pair(processID, pageIndex)));
+	mergedPages--;
+
+	if (sharers.empty())
+	{
+		physicalMemory.remove({ shared->first });
+		availableMemory += memoryPerFrame;
+
+		sharedFrames.erase(shared);
+		sharedFrameCount--;
+	}
 }
 
-bool MMU::isValid(unsigned long long processID, unsigned long long frameID)
+std::optional<size_t> MMU::translate(PageTable& table, unsigned long long processID, uint32_t address, std::unique_lock<std::mutex>& tableLock, bool forWrite)
 {
-	auto pair = masterTable.find(processID);
+	size_t location = address / memoryPerFrame;
 
-	if (pair == masterTable.end())
+	if (address >= table.limit || location >= table.numPages)
 	{
-		std::cerr << "\nError: Process page table not contained\n";
-		return false;
+		//std::cerr << "\nError: Invalid address\n";
+		return std::nullopt;
 	}
 
-	PageTable& table = masterTable.at(processID);
+	Page* page = findPage(table, location);
 
-	for (Page& page : table.pages)
+	if (!page || !page->valid || (forWrite && page->shared))
 	{
-		if (page.frameID == frameID)
+		//std::cout << "\n\nPage Fault Occured\n\n";
+		tableLock.unlock();
+		std::unique_lock<std::mutex> evictionLock(evictionMutex);
+		tableLock.lock();
+
+		faultIn(table, processID, location);
+
+		page = findPage(table, location);
+
+		if (forWrite && page->shared)
 		{
-			if (page.valid)
-			{
-				return true;
-			}
+			copyOnWrite(table, processID, location);
+		}
+
+		// A copy that failed leaves the page on the shared frame,
+		// which the write must not reach
+		if (!page->valid || (forWrite && page->shared))
+		{
+			return std::nullopt;
 		}
 	}
 
-	return false;
+	reference(table, location);
+
+	return getSlot(*page, location) * memoryPerFrame + address % memoryPerFrame;
 }
 
-bool MMU::validAccess(unsigned long long processID, size_t physicalMemoryLocation)
+bool MMU::readBytes(PageTable& table, unsigned long long processID, uint32_t address, std::span<uint8_t> buffer, std::unique_lock<std::mutex>& tableLock)
 {
-	PageTable table = masterTable.at(processID);
-	std::optional<unsigned long long> frameID = physicalMemory.getFrameID(physicalMemoryLocation);
+	if (buffer.empty() || address + buffer.size() > table.limit)
+	{
+		return false;
+	}
 
-	if (frameID)
+	size_t done = 0;
+
+	// One translation and one copy per page the access touches
+	while (done < buffer.size())
 	{
-		for (Page& page : table.pages)
+		size_t current = address + done;
+		size_t length = std::min(buffer.size() - done, memoryPerFrame - current % memoryPerFrame);
+		std::optional<size_t> physicalAddress = translate(table, processID, static_cast<uint32_t>(current), tableLock, false);
+
+		if (!physicalAddress || !physicalMemory.readBytes(*physicalAddress, buffer.subspan(done, length)))
 		{
-			if (page.frameID == frameID)
-			{
-				return true;
-			}
+			return false;
 		}
 
-		return false;
+		done += length;
 	}
-	else
+
+	return true;
+}
+
+bool MMU::writeBytes(PageTable& table, unsigned long long processID, uint32_t address, std::span<const uint8_t> data, std::unique_lock<std::mutex>& tableLock)
+{
+	if (data.empty() || address + data.size() > table.limit)
 	{
 		return false;
 	}
+
+	size_t done = 0;
+
+	while (done < data.size())
+	{
+		size_t current = address + done;
+		size_t length = std::min(data.size() - done, memoryPerFrame - current % memoryPerFrame);
+		std::optional<size_t> physicalAddress = translate(table, processID, static_cast<uint32_t>(current), tableLock, true);
+
+		if (!physicalAddress || !physicalMemory.writeBytes(*physicalAddress, data.subspan(done, length)))
+		{
+			return false;
+		}
+
+		// Dirty before the next page can fault and evict this one
+		setDirty(*findPage(table, current / memoryPerFrame), true);
+
+		done += length;
+	}
+
+	return true;
 }
 
 // ----- << Public Member Function Implementation >> -----//
-MMU::MMU(size_t maximumMemoryPerProcess, size_t maximumOverallMemory, size_t memoryPerFrame, size_t minimumMemoryPerProcess, bool& breaker)
-	: physicalMemory(static_cast<size_t>(1) << memoryPerFrame, static_cast<size_t>(1) << maximumOverallMemory),
-	availableMemory(static_cast<size_t>(1) << maximumOverallMemory),				framesCreated(0),
+MMU::MMU(size_t maximumMemoryPerProcess, size_t maximumOverallMemory, size_t memoryPerFrame, size_t minimumMemoryPerProcess, std::string pageReplacement, std::string backingStoreMode, std::string backingStorePath, size_t readAheadWindow, size_t compressedPoolSize, size_t hugePageSize, bool& breaker)
+	: breaker(breaker),																flusherRunning(true),
+	mergerRunning(true),															framesCreated(0),
+	availableMemory(static_cast<size_t>(1) << maximumOverallMemory),
 	maximumMemoryPerProcess(static_cast<size_t>(1) << maximumMemoryPerProcess),		maximumOverallMemory(static_cast<size_t>(1) << maximumOverallMemory),
 	memoryPerFrame(static_cast<size_t>(1) << memoryPerFrame),						minimumMemoryPerProcess(static_cast<size_t>(1) << minimumMemoryPerProcess),
-	dataPlaceholder(""),															breaker(breaker),
-	pagesIn(0),																		pagesOut(0)
+	readAheadWindow(readAheadWindow),												pageTableMemory(0),
+	pagesIn(0),																		pagesOut(0),
+	asyncWriteBacks(0),																syncWriteBacks(0),
+	dirtyFrames(0),																	pageFaults(0),
+	retiredReferences(0),															copyOnWrites(0),
+	mergedPages(0),																	sharedFrameCount(0),
+	activeWorkingSet(0),															suspendedProcesses(0),
+	swappedInPages(0),																reservedFrames(0),
+	physicalMemory(static_cast<size_t>(1) << memoryPerFrame, static_cast<size_t>(1) << maximumOverallMemory, pageReplacement, backingStoreMode, backingStorePath, compressedPoolSize)
 {
 	numFramesPerProcess = maximumMemoryPerProcess / memoryPerFrame;
 	limitHigh = maximumMemoryPerProcess;
 
-	size_t bytes = static_cast<size_t>(1) << memoryPerFrame;
+	size_t numFrames = this->maximumOverallMemory / this->memoryPerFrame;
+
+	// Both sizes are exponents
+	size_t hugeFrames = hugePageSize > memoryPerFrame && hugePageSize - memoryPerFrame < 32 ? static_cast<size_t>(1) << (hugePageSize - memoryPerFrame) : 1;
+
+	hugePages = hugeFrames > 1 && hugeFrames <= numFrames / 4;
+	pagesPerTable = hugePages ? hugeFrames : basePagesPerTable;
+
+	// Start cleaning once a quarter of the frames are dirty and
+	// stop once only an eighth are
+	cleanLowWatermark = std::max<size_t>(1, numFrames - numFrames / 4);
+	cleanHighWatermark = std::max<size_t>(cleanLowWatermark, numFrames - numFrames / 8);
+
+	flusherThread = std::thread(&MMU::flusherFunction, this);
+	mergerThread = std::thread(&MMU::mergerFunction, this);
+}
+
+MMU::~MMU()
+{
+	stopBackgroundThreads();
+}
+
+bool MMU::activate(unsigned long long processID)
+{
+	std::shared_ptr<PageTable> table = findTable(processID);
+
+	if (!table)
+	{
+		return true;
+	}
+
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+
+	if (!table->suspended)
+	{
+		return true;
+	}
+
+	size_t numFrames = maximumOverallMemory / memoryPerFrame;
 
-	for (size_t i = 0; i < bytes; i++)
+	// Always let one process run so a working set larger than
+	// physical memory cannot stall the system
+	if (activeWorkingSet != 0 && activeWorkingSet + table->workingSetSize > numFrames)
 	{
-		dataPlaceholder += "00";
+		return false;
 	}
+
+	table->suspended = false;
+	table->activatedAt = table->references;
+	activeWorkingSet += table->workingSetSize;
+	suspendedProcesses--;
+
+	return true;
 }
 
-MMU::~MMU() = default;
+size_t MMU::swapIn(unsigned long long processID)
+{
+	std::unique_lock<std::mutex> evictionLock(evictionMutex);
+
+	std::shared_ptr<PageTable> table = findTable(processID);
+
+	if (!table)
+	{
+		return 0;
+	}
+
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+
+	// Suspended again before it ran, the pages stay out
+	if (table->suspended)
+	{
+		return 0;
+	}
+
+	std::vector<size_t> swapped;
+	swapped.swap(table->swappedPages);
+
+	size_t budget = availableMemory / memoryPerFrame;
+	size_t restored = 0;
+	size_t start = 0;
+
+	while (start < swapped.size() && restored < budget)
+	{
+		size_t first = swapped[start];
+
+		if (table->directory[first / pagesPerTable].huge)
+		{
+			start++;
+			continue;
+		}
+
+		// A run is consecutive pages of one second-level table that
+		// are still out
+		size_t count = 0;
+		bool anyBacked = false;
+
+		while (start + count < swapped.size() && restored + count < budget)
+		{
+			size_t pageIndex = swapped[start + count];
+			Page* page = findPage(*table, pageIndex);
+
+			if (pageIndex != first + count || pageIndex / pagesPerTable != first / pagesPerTable || !page || page->valid || page->shared)
+			{
+				break;
+			}
+
+			anyBacked = anyBacked || page->backed;
+			count++;
+		}
+
+		if (count == 0)
+		{
+			start++;
+			continue;
+		}
+
+		std::vector<uint8_t> buffer;
+
+		if (anyBacked)
+		{
+			buffer.resize(count * memoryPerFrame);
+			physicalMemory.readBackingStore(table->firstFrameID + first, count, buffer.data());
+		}
+
+		for (size_t i = 0; i < count; i++)
+		{
+			Page& target = *findPage(*table, first + i);
+			std::optional<size_t> slot = obtainSlot(*table);
+
+			if (!slot)
+			{
+				swappedInPages += restored;
+				return restored;
+			}
+
+			loadPage(target, *slot, anyBacked && target.backed ? buffer.data() + i * memoryPerFrame : nullptr);
+			target.slot = *slot;
+			invertedTable[target.frameID] = { processID, first + i };
+			pinFrame(*table, *slot);
+
+			pagesIn++;
+			restored++;
+		}
+
+		start += count;
+	}
+
+	swappedInPages += restored;
+
+	return restored;
+}
 
 size_t MMU::countValid(unsigned long long processID)
 {
-	auto pair = masterTable.find(processID);
+	std::shared_ptr<PageTable> table = findTable(processID);
 
-	if (pair == masterTable.end())
+	if (!table)
 	{
 		std::cerr << "Error: Process page table not contained\n";
 		throw std::runtime_error("Error: Process page table not contained\n");
 	}
 
-	PageTable& table = masterTable.at(processID);
+	std::unique_lock<std::mutex> tableLock(table->mutex);
 
 	size_t count = 0;
-	for (const auto& page : table.pages)
+	for (size_t i = 0; i < table->numPages; i = nextPage(*table, i))
 	{
-		if (page.valid)
+		Page* page = findPage(*table, i);
+
+		if (page && page->valid)
 		{
-			count++;
+			count += page->huge ? pagesPerTable : 1;
 		}
 	}
 
@@ -159,58 +1264,183 @@ size_t MMU::countValid(unsigned long long processID)
 
 void MMU::createPages(unsigned long long processID)
 {
-	std::unique_lock<std::mutex> createPageLock(createPageMutex);
+	createPages(processID, limitHigh);
+}
+
+void MMU::createPages(unsigned long long processID, size_t requiredMemory)
+{
+	size_t pagesRequired;
+
+	if (requiredMemory <= memoryPerFrame)
+	{
+		pagesRequired = 1;
+	}
+	else
+	{
+		pagesRequired = (requiredMemory + memoryPerFrame - 1) / memoryPerFrame;
+	}
+
+	if (findTable(processID))
+	{
+		return;
+	}
+
+	// Pages start unbacked, frame IDs are assigned on the first fault.
+	// Second-level tables are allocated on the first use of a page
+	std::shared_ptr<PageTable> table = std::make_shared<PageTable>();
+	table->directory.resize((pagesRequired + pagesPerTable - 1) / pagesPerTable);
+	table->numPages = pagesRequired;
+	table->limit = requiredMemory;
+	table->firstFrameID = framesCreated.fetch_add(pagesRequired);
+
+	// Every full range is one huge page, a partial one at the end
+	// keeps base pages
+	for (size_t i = 0; hugePages && i < pagesRequired / pagesPerTable; i++)
+	{
+		table->directory[i].huge = true;
+	}
+
+	pageTableMemory += table->directory.size() * sizeof(DirectoryEntry);
+
+	physicalMemory.reserveBackingStore(table->firstFrameID + pagesRequired);
+
+	Shard& shard = masterTable[processID % numShards];
+	std::unique_lock<std::mutex> shardLock(shard.mutex);
+
+	shard.tables.emplace(processID, std::move(table));
+}
+
+bool MMU::reserveFrames(unsigned long long processID, size_t requiredMemory, size_t frames)
+{
+	size_t numFrames = maximumOverallMemory / memoryPerFrame;
+	size_t pagesRequired = requiredMemory <= memoryPerFrame ? 1 : (requiredMemory + memoryPerFrame - 1) / memoryPerFrame;
+	size_t reservation = std::min({ frames, pagesRequired, numFrames });
+	size_t reserved = reservedFrames;
+
+	// Granted atomically, so concurrent admissions never reserve more
+	// frames than exist
+	do
+	{
+		if (reserved + reservation > numFrames)
+		{
+			return false;
+		}
+	} while (!reservedFrames.compare_exchange_weak(reserved, reserved + reservation));
+
+	createPages(processID, requiredMemory);
+
+	std::shared_ptr<PageTable> table = findTable(processID);
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+
+	table->reservation += reservation;
+
+	return true;
+}
+
+size_t MMU::getAvailableMemory() const
+{
+	return availableMemory;
+}
+
+size_t MMU::getActiveWorkingSet() const
+{
+	return activeWorkingSet;
+}
+
+double MMU::getCompressionRatio()
+{
+	return physicalMemory.getCompressionRatio();
+}
+
+size_t MMU::getCopyOnWrites() const
+{
+	return copyOnWrites;
+}
 
-	PageTable table;
-	table.pages.resize(numFramesPerProcess);
-	table.limit = limitHigh;
+double MMU::getFaultRate()
+{
+	size_t references = retiredReferences;
 
-	size_t limit = framesCreated + numFramesPerProcess;
-	size_t pagesIndex = 0;
-	for (; framesCreated < limit; ++framesCreated)
+	for (Shard& shard : masterTable)
 	{
-		if (breaker) break;
+		std::unique_lock<std::mutex> shardLock(shard.mutex);
+
+		for (const auto& [processID, table] : shard.tables)
+		{
+			references += table->references;
+		}
+	}
 
-		physicalMemory.writeBackingStore(framesCreated, dataPlaceholder);
-		table.pages[pagesIndex++] = { false, false, framesCreated };
+	if (references == 0)
+	{
+		return 0.0;
 	}
 
-	masterTable.emplace(processID, std::move(table));
+	return 1000.0 * pageFaults / references;
 }
 
-void MMU::createPages(unsigned long long processID, size_t requiredMemory)
+size_t MMU::getMergedPages() const
+{
+	return mergedPages;
+}
+
+size_t MMU::getPageFaults() const
+{
+	return pageFaults;
+}
+
+size_t MMU::getPageTableMemory() const
+{
+	return pageTableMemory;
+}
+
+size_t MMU::getSwapPoolHits() const
+{
+	return physicalMemory.getSwapPoolHits();
+}
+
+size_t MMU::getSharedFrames() const
+{
+	return sharedFrameCount;
+}
+
+size_t MMU::getSuspendedProcesses() const
+{
+	return suspendedProcesses;
+}
+
+size_t MMU::getSwappedInPages() const
+{
+	return swappedInPages;
+}
+
+size_t MMU::getReservedFrames() const
+{
+	return reservedFrames;
+}
+
+size_t MMU::getWorkingSetSize(unsigned long long processID)
 {
-	std::unique_lock<std::mutex> createPageLock(createPageMutex);
-	size_t pagesRequired;
+	std::shared_ptr<PageTable> table = findTable(processID);
 
-	if (requiredMemory <= memoryPerFrame)
-	{
-		pagesRequired = 1;
-	}
-	else
+	if (!table)
 	{
-		pagesRequired = requiredMemory / memoryPerFrame;
+		return 0;
 	}
 
-	PageTable table;
-	table.pages.resize(pagesRequired);
-	table.limit = requiredMemory;
-	
-	size_t limit = framesCreated + pagesRequired;
-	size_t pagesIndex = 0;
+	std::unique_lock<std::mutex> tableLock(table->mutex);
 
-	for (; framesCreated < limit; ++framesCreated)
-	{
-		physicalMemory.writeBackingStore(framesCreated, dataPlaceholder);
-		table.pages[pagesIndex++] = { false, false, framesCreated };
-	}
+	return table->workingSetSize;
+}
 
-	masterTable.emplace(processID, std::move(table));
+size_t MMU::getAsyncWriteBacks() const
+{
+	return asyncWriteBacks;
 }
 
-size_t MMU::getAvailableMemory() const
+size_t MMU::getSyncWriteBacks() const
 {
-	return availableMemory;
+	return syncWriteBacks;
 }
 
 size_t MMU::getPagesIn() const
@@ -223,98 +1453,180 @@ size_t MMU::getPagesOut() const
 	return pagesOut;
 }
 
+
+
 void MMU::handlePageFault(unsigned long long processID, unsigned long long requestedPage)
 {
-	std::unique_lock<std::mutex> pageFaultLock(pageFaultMutex);
+	std::unique_lock<std::mutex> evictionLock(evictionMutex);
 
-	auto mTable = masterTable.find(processID);
-	if (mTable == masterTable.end())
+	std::shared_ptr<PageTable> table = findTable(processID);
+
+	if (!table)
 	{
 		throw std::runtime_error("ERROR: Process not in master table\n");
 	}
 
-	PageTable& table = mTable->second;
-	if (requestedPage >= table.pages.size())
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+
+	if (requestedPage >= table->numPages)
 	{
 		throw std::out_of_range("ERROR: Requested page index is out of range\n");
 	}
 
-	Page& page = table.pages[requestedPage];
+	faultIn(*table, processID, requestedPage);
+}
 
-	std::optional<size_t> freeKey = physicalMemory.findFreeFrame();
+bool MMU::loadProcess(unsigned long long processID)
+{
+	std::shared_ptr<PageTable> table = findTable(processID);
 
-	if (!freeKey)
+	if (!table)
 	{
-		size_t victimKey = physicalMemory.getVictimKey();
+		throw std::runtime_error("Error: Process page table not contained in master table\n");
+	}
 
-		std::optional<unsigned long long> victimFrameID = physicalMemory.getFrameID(victimKey);
+	std::unique_lock<std::mutex> evictionLock(evictionMutex);
+	std::unique_lock<std::mutex> tableLock(table->mutex);
 
-		if (victimFrameID)
-		{
-			Page* victimPage = getPage(*victimFrameID);
+	for (size_t i = 0; i < table->numPages; i++)
+	{
+		faultIn(*table, processID, i);
+	}
 
-			if (victimPage)
-			{
-				if (victimPage->dirty)
-				{
-					physicalMemory.overwriteBackingStore(victimKey);
-					victimPage->dirty = false;
-				}
+	for (size_t i = 0; i < table->numPages; i = nextPage(*table, i))
+	{
+		Page* page = findPage(*table, i);
 
-				victimPage->valid = false;
-			}
-		}
-		else
+		if (!page || !page->valid)
 		{
-			std::cerr << "\nError: Victim Frame not in memory\n";
-			return;
+			return false;
 		}
-
-		physicalMemory.updateFrame(page.frameID, victimKey);
-		page.valid = true;
-
-		pagesIn++;
-		pagesOut++;
 	}
-	else
-	{
-		if (!physicalMemory.find(page.frameID))
-		{
-			physicalMemory.updateFrame(page.frameID, *freeKey);
-			page.valid = true;
 
-			availableMemory -= memoryPerFrame;
+	return true;
+}
 
-			pagesIn++;
-		}
-	}
+size_t MMU::exportBackingStore(const std::string& path)
+{
+	return physicalMemory.exportBackingStore(path);
 }
 
-bool MMU::loadProcess(unsigned long long processID)
+bool MMU::forkPages(unsigned long long parentID, unsigned long long childID)
 {
-	std::unique_lock<std::recursive_mutex> readWriteLock(readWriteMutex);
-	auto check = masterTable.find(processID);
+	std::unique_lock<std::mutex> evictionLock(evictionMutex);
 
-	if (check == masterTable.end())
+	std::shared_ptr<PageTable> parent = findTable(parentID);
+
+	if (!parent || findTable(childID))
 	{
-		throw std::runtime_error("Error: Process page table not contained in master table\n");
+		return false;
+	}
+
+	std::unique_lock<std::mutex> parentLock(parent->mutex);
+
+	size_t numPages = parent->numPages;
+
+	std::shared_ptr<PageTable> child = std::make_shared<PageTable>();
+	child->directory.resize(parent->directory.size());
+	child->numPages = numPages;
+	child->limit = parent->limit;
+	child->firstFrameID = framesCreated.fetch_add(numPages);
+
+	for (size_t i = 0; i < child->directory.size(); i++)
+	{
+		child->directory[i].huge = parent->directory[i].huge;
 	}
 
-	PageTable& table = masterTable.at(processID);
+	pageTableMemory += child->directory.size() * sizeof(DirectoryEntry);
+	physicalMemory.reserveBackingStore(child->firstFrameID + numPages);
+
+	// Swapped out pages are read in one run and written to the
+	// slots of the child
+	std::vector<uint8_t> buffer;
 
-	for (auto& page : table.pages)
+	for (size_t i = 0; i < numPages; i = nextPage(*parent, i))
 	{
-		handlePageFault(processID, getPageIndex(page.frameID));
+		Page* page = findPage(*parent, i);
+
+		if (page && !page->valid && page->backed)
+		{
+			buffer.resize(numPages * memoryPerFrame);
+			physicalMemory.readBackingStore(parent->firstFrameID, numPages, buffer.data());
+			break;
+		}
 	}
 
-	for (auto& page : table.pages)
+	std::vector<uint8_t> data(pagesPerTable * memoryPerFrame);
+
+	for (size_t i = 0; i < numPages; i = nextPage(*parent, i))
 	{
-		if (!page.valid)
+		Page* page = findPage(*parent, i);
+
+		// Unused pages of the child stay unbacked zero pages
+		if (!page || (!page->valid && !page->backed))
 		{
-			return false;
+			continue;
+		}
+
+		size_t count = page->huge ? pagesPerTable : 1;
+		Page& target = getPage(*child, i);
+
+		target.frameID = child->firstFrameID + i;
+
+		if (!page->valid)
+		{
+			physicalMemory.writeBackingStore(target.frameID, count, buffer.data() + i * memoryPerFrame);
+			target.backed = true;
+			continue;
+		}
+
+		// Huge pages are never shared, the child gets a copy in its
+		// backing store slots
+		if (page->huge)
+		{
+			if (physicalMemory.copyFrame(page->frameID, data.data()))
+			{
+				physicalMemory.writeBackingStore(target.frameID, count, data.data());
+				target.backed = true;
+			}
+
+			continue;
+		}
+
+		auto shared = sharedFrames.end();
+
+		if (page->shared)
+		{
+			std::optional<unsigned long long> sharedID = physicalMemory.getFrameID(page->slot);
+			shared = sharedID ? sharedFrames.find(*sharedID) : sharedFrames.end();
+		}
+		else if (physicalMemory.copyFrame(page->frameID, data.data()))
+		{
+			shared = shareFrame(*parent, parentID, i, hashFrame(data.data()));
+		}
+
+		if (shared == sharedFrames.end())
+		{
+			continue;
 		}
+
+		// An unbacked page that was never dirty is all zeros, which
+		// an unbacked page of the child already is
+		target.valid = true;
+		target.shared = true;
+		target.inherited = page->backed || page->inherited;
+		target.slot = page->slot;
+		child->sharedSlots[target.slot]++;
+		shared->second.sharers.push_back({ childID, i });
+
+		mergedPages++;
 	}
 
+	Shard& shard = masterTable[childID % numShards];
+	std::unique_lock<std::mutex> shardLock(shard.mutex);
+
+	shard.tables.emplace(childID, std::move(child));
+
 	return true;
 }
 
@@ -327,241 +1639,416 @@ void MMU::printMasterTable()
 {
 	std::cout << "---------- Master Table ----------\n";
 
-	for (const auto& [processID, table] : masterTable)
+	for (Shard& shard : masterTable)
 	{
-		std::cout << "Process ID: " << processID << "\n";
+		std::unique_lock<std::mutex> shardLock(shard.mutex);
 
-		if (table.pages.empty())
+		for (const auto& [processID, table] : shard.tables)
 		{
-			std::cout << "     (No pages)\n";
-			continue;
-		}
+			std::unique_lock<std::mutex> tableLock(table->mutex);
 
-		for (size_t i = 0; i < table.pages.size(); ++i)
-		{
-			const Page& page = table.pages[i];
-			std::cout << "     Page[" << i << "]"
-				<< " FrameID=" << page.frameID
-				<< " Valid=" << (page.valid ? "true" : "false")
-				<< " Dirty=" << (page.dirty ? "true" : "false")
-				<< "\n";
-		}
+			std::cout << "Process ID: " << processID << "\n";
 
+			if (table->numPages == 0)
+			{
+				std::cout << "     (No pages)\n";
+				continue;
+			}
+
+			// Pages without a second-level table are not shown
+			for (size_t i = 0; i < table->numPages; i = nextPage(*table, i))
+			{
+				const Page* page = findPage(*table, i);
+
+				if (!page)
+				{
+					continue;
+				}
+
+				std::cout << "     Page[" << i << "]"
+					<< " FrameID=" << page->frameID
+					<< " Valid=" << (page->valid ? "true" : "false")
+					<< " Dirty=" << (page->dirty ? "true" : "false")
+					<< " Shared=" << (page->shared ? "true" : "false")
+					<< " Huge=" << (page->huge ? "true" : "false")
+					<< "\n";
+			}
+		}
 	}
 }
 
-std::optional<std::string> MMU::protectedRead(unsigned long long processID, std::string address, size_t bytesToRead)
+std::optional<uint16_t> MMU::protectedRead(unsigned long long processID, uint32_t address)
 {
-	std::unique_lock<std::recursive_mutex> rReadLock(readWriteMutex);
-
-	auto pair = masterTable.find(processID);
+	std::shared_ptr<PageTable> table = findTable(processID);
 
-	if (pair == masterTable.end())
+	if (!table)
 	{
 		std::cerr << "\nError: Process page table not contained\n";
 		return std::nullopt;
 	}
 
-	PageTable& table = masterTable.at(processID);
-	size_t base = physicalMemory.convertHexToDecimal(address);
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+	uint8_t bytes[2];
 
-	if (base >= table.limit)
+	if (!readBytes(*table, processID, address, bytes, tableLock))
 	{
-		//std::cerr << "\nError: Invalid address\n";
 		return std::nullopt;
 	}
 
-	size_t location = base / memoryPerFrame;
-	size_t newAddress = 0;
-	size_t offset = 0;
+	return static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
+}
+
+std::optional<uint16_t> MMU::protectedRead(unsigned long long processID, uint32_t address, TLB& tlb)
+{
+	size_t pageIndex = address / memoryPerFrame;
+	size_t offset = address % memoryPerFrame;
 
-	unsigned long long requestedFrame = table.pages[location].frameID;
-	std::optional<size_t> readLocation = physicalMemory.find(requestedFrame);
+	// Values that cross into the next page always take the page table
+	std::optional<TLB::Entry> entry = offset + 2 <= memoryPerFrame ? tlb.lookup(processID, pageIndex) : std::nullopt;
 
-	if (readLocation)
+	if (entry)
 	{
-		offset = base % memoryPerFrame;
-		newAddress = *(readLocation)*memoryPerFrame + offset;
+		std::unique_lock<std::mutex> tableLock(entry->table->mutex);
+
+		// A shootdown after the lookup (remove clears the directory
+		// right after one) sends the access down the slow path
+		bool current = entry->epoch == entry->table->shootdownEpoch && pageIndex < entry->table->numPages;
+		Page* page = current ? findPage(*entry->table, pageIndex) : nullptr;
+		uint8_t bytes[2];
+
+		// The page may have been evicted or merged after the
+		// lookup
+		if (page && page->valid && getSlot(*page, pageIndex) == entry->slot &&
+			physicalMemory.readBytes(entry->slot * memoryPerFrame + offset, bytes))
+		{
+			reference(*entry->table, pageIndex);
 
-		return read(processID, physicalMemory.convertDecToHex(newAddress), bytesToRead);
+			return static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
+		}
 	}
-	else
+
+	std::shared_ptr<PageTable> table = findTable(processID);
+
+	if (!table)
 	{
-		//std::cout << "\n\nREAD Page Fault Occured\n\n";
-		Page* page = getPage(requestedFrame);
+		std::cerr << "\nError: Process page table not contained\n";
+		return std::nullopt;
+	}
 
-		if (page)
-		{
-			handlePageFault(processID, getPageIndex(page->frameID));
-		}
-		else
-		{
-			std::cerr << "\nError: Page not in master table\n";
-		}
-		return protectedRead(processID, address, bytesToRead);
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+	uint8_t bytes[2];
+
+	if (!readBytes(*table, processID, address, bytes, tableLock))
+	{
+		return std::nullopt;
 	}
+
+	fillTLB(tlb, table, processID, pageIndex);
+
+	return static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
 }
 
-bool MMU::protectedWrite(unsigned long long processID, std::string address, std::string data)
+std::optional<std::string> MMU::protectedRead(unsigned long long processID, std::string address, size_t bytesToRead)
 {
-	std::unique_lock<std::recursive_mutex> rWriteLock(readWriteMutex);
+	size_t base = physicalMemory.convertHexToDecimal(address);
+
+	if (base > UINT32_MAX || bytesToRead == 0)
+	{
+		return std::nullopt;
+	}
 
-	auto pair = masterTable.find(processID);
+	std::vector<uint8_t> bytes(bytesToRead);
 
-	if (pair == masterTable.end())
+	if (!readBytes(processID, static_cast<uint32_t>(base), bytes))
 	{
-		std::cerr << "\nError: Process page table not contained\n";
-		return false;
+		return std::nullopt;
 	}
 
-	PageTable& table = masterTable.at(processID);
-	size_t base = physicalMemory.convertHexToDecimal(address);
+	std::ostringstream stream;
+	stream << std::hex << std::uppercase << std::setfill('0');
 
-	if (base >= table.limit)
+	for (uint8_t byte : bytes)
 	{
-		//std::cerr << "\nError: Invalid address\n";
-		return false;
+		stream << std::setw(2) << static_cast<unsigned int>(byte);
 	}
 
-	size_t location = base / memoryPerFrame;
-	
-	unsigned long long requestedFrame = table.pages[location].frameID;
-	std::optional<size_t> writeLocation = physicalMemory.find(requestedFrame);
+	return stream.str();
+}
 
-	// Address translation
-	size_t offset = 0;
-	size_t newAddress = 0;
+bool MMU::protectedWrite(unsigned long long processID, uint32_t address, uint16_t data)
+{
+	std::shared_ptr<PageTable> table = findTable(processID);
 
-	if (writeLocation)
+	if (!table)
 	{
-		offset = base % memoryPerFrame;
-		newAddress = *(writeLocation)*memoryPerFrame + offset;
-
-		return write(processID, physicalMemory.convertDecToHex(newAddress), data);
+		std::cerr << "\nError: Process page table not contained\n";
+		return false;
 	}
-	else
+
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+	uint8_t bytes[2] = { static_cast<uint8_t>(data >> 8), static_cast<uint8_t>(data & 0xFF) };
+
+	return writeBytes(*table, processID, address, bytes, tableLock);
+}
+
+bool MMU::protectedWrite(unsigned long long processID, uint32_t address, uint16_t data, TLB& tlb)
+{
+	size_t pageIndex = address / memoryPerFrame;
+	size_t offset = address % memoryPerFrame;
+	uint8_t bytes[2] = { static_cast<uint8_t>(data >> 8), static_cast<uint8_t>(data & 0xFF) };
+
+	std::optional<TLB::Entry> entry = offset + 2 <= memoryPerFrame ? tlb.lookup(processID, pageIndex) : std::nullopt;
+
+	if (entry)
 	{
-		//std::cout << "\n\nWRITE Page Fault Occured" << processID << "\n\n";
-		Page* page = getPage(requestedFrame);
+		std::unique_lock<std::mutex> tableLock(entry->table->mutex);
 
-		if (page)
-		{
-			handlePageFault(processID, getPageIndex(page->frameID));
-		}
-		else
+		// A shootdown after the lookup (remove clears the directory
+		// right after one) sends the access down the slow path
+		bool current = entry->epoch == entry->table->shootdownEpoch && pageIndex < entry->table->numPages;
+		Page* page = current ? findPage(*entry->table, pageIndex) : nullptr;
+
+		// The page may have been evicted or merged after the
+		// lookup
+		if (page && page->valid && !page->shared && getSlot(*page, pageIndex) == entry->slot)
 		{
-			std::cerr << "\nError: Page not in master table\n";
-		}
+			physicalMemory.writeBytes(entry->slot * memoryPerFrame + offset, bytes);
+			setDirty(*page, true);
+			reference(*entry->table, pageIndex);
 
-		return protectedWrite(processID, address, data);
+			return true;
+		}
 	}
-}
 
-std::optional<std::string> MMU::read(unsigned long long processID, std::string address, size_t bytesToRead)
-{
-	std::unique_lock<std::mutex> readLock(readMutex);
+	std::shared_ptr<PageTable> table = findTable(processID);
 
-	size_t base = physicalMemory.convertHexToDecimal(address);
-	size_t location = base / memoryPerFrame;
+	if (!table)
+	{
+		std::cerr << "\nError: Process page table not contained\n";
+		return false;
+	}
 
-	if (!validAccess(processID, location))
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+
+	if (!writeBytes(*table, processID, address, bytes, tableLock))
 	{
-		//std::cerr << "\nError: Invalid access\n";
-		return std::nullopt;
+		return false;
 	}
 
-	if ((base + bytesToRead - 1) > maximumOverallMemory)
+	fillTLB(tlb, table, processID, pageIndex);
+
+	return true;
+}
+
+bool MMU::protectedWrite(unsigned long long processID, std::string address, std::string data)
+{
+	size_t base = physicalMemory.convertHexToDecimal(address);
+
+	if (base > UINT32_MAX)
 	{
-		//std::cerr << "\nError: Invalid Address]n";
-		return std::nullopt;
+		return false;
 	}
 
-	std::string data = "";
+	// Two hexadecimal characters per byte, an odd count is padded
+	// with a leading 0
+	size_t padding = data.size() % 2;
+	std::vector<uint8_t> bytes((data.size() + padding) / 2, 0);
 
-	for (size_t i = 0; i < bytesToRead; i++)
+	for (size_t i = 0; i < data.size(); i++)
 	{
-		auto byte = physicalMemory.read(physicalMemory.convertDecToHex(base++));
+		std::optional<uint8_t> digit = hexDigit(data[i]);
 
-		if (byte)
+		if (!digit)
 		{
-			data += *byte;
-			continue;
+			throw std::runtime_error("\nERROR: Invalid characters found in raw string\n");
 		}
 
-		//std::cerr << "\nError: Physical Memory Read unsuccessful\n";
-		return std::nullopt;
+		size_t position = i + padding;
+		bytes[position / 2] |= *digit << (position % 2 == 0 ? 4 : 0);
+	}
+
+	return writeBytes(processID, static_cast<uint32_t>(base), bytes);
+}
+
+bool MMU::readBytes(unsigned long long processID, uint32_t address, std::span<uint8_t> buffer)
+{
+	std::shared_ptr<PageTable> table = findTable(processID);
+
+	if (!table)
+	{
+		std::cerr << "\nError: Process page table not contained\n";
+		return false;
 	}
 
-	return data;
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+
+	return readBytes(*table, processID, address, buffer, tableLock);
 }
 
 void MMU::remove(unsigned long long processID)
 {
-	auto pair = masterTable.find(processID);
+	std::unique_lock<std::mutex> evictionLock(evictionMutex);
 
-	if (pair == masterTable.end())
+	std::shared_ptr<PageTable> table = findTable(processID);
+
+	if (!table)
 	{
 		std::cerr << "\nError: Process page table not contained\n";
 		return;
 	}
 
-	PageTable table = masterTable[processID];
+	std::unique_lock<std::mutex> tableLock(table->mutex);
 	std::vector<unsigned long long> rmVector;
 
-	for (auto& page : table.pages)
+	// A suspended working set is not part of the active one
+	if (table->suspended)
+	{
+		table->suspended = false;
+		table->workingSetSize = 0;
+		suspendedProcesses--;
+	}
+
+	table->swappedPages.clear();
+
+	reservedFrames -= table->reservation;
+	table->reservation = 0;
+
+	setWorkingSetSize(*table, 0);
+
+	for (size_t i = 0; i < table->numPages; i = nextPage(*table, i))
 	{
-		page.valid = false;
-		rmVector.push_back(page.frameID);
+		Page* page = findPage(*table, i);
+
+		if (!page)
+		{
+			continue;
+		}
+
+		if (page->shared)
+		{
+			// The contents are discarded with the process
+			page->inherited = false;
+			unshare(*table, processID, i);
+		}
+
+		if (page->frameID == static_cast<unsigned long long>(-1))
+		{
+			continue;
+		}
+
+		setDirty(*page, false);
+		page->valid = false;
+		rmVector.push_back(page->frameID);
+		invertedTable.erase(page->frameID);
 	}
 
+	table->pinned = 0;
+	releaseTables(*table);
+	shootdown(*table);
+
 	size_t removed = physicalMemory.remove(rmVector);
 
 	availableMemory += removed * memoryPerFrame;
 	pagesOut += removed;
+
+	// Swapped out pages of the process would otherwise keep their
+	// compressed copies in the pool
+	physicalMemory.discardBackingStore(table->firstFrameID, table->numPages);
+
+	// A thread that found the table before it was erased sees no
+	// pages and fails like an unknown process
+	pageTableMemory -= table->directory.size() * sizeof(DirectoryEntry);
+	table->directory.clear();
+	table->numPages = 0;
+	table->limit = 0;
+	retiredReferences += table->references;
+
+	Shard& shard = masterTable[processID % numShards];
+	std::unique_lock<std::mutex> shardLock(shard.mutex);
+
+	shard.tables.erase(processID);
 }
 
-bool MMU::write(unsigned long long processID, std::string address, std::string data)
+void MMU::stopBackgroundThreads()
 {
-	std::unique_lock<std::mutex> writeLock(writeMutex);
+	{
+		std::unique_lock<std::mutex> flusherLock(flusherMutex);
+		flusherRunning = false;
+	}
 
-	size_t base = physicalMemory.convertHexToDecimal(address);
-	size_t location = base / memoryPerFrame;
+	flusherCondition.notify_all();
 
-	if (!validAccess(processID, location))
+	if (flusherThread.joinable())
 	{
-		//std::cout << "\nError: Invalid access\n";
-		return false;
+		flusherThread.join();
+	}
+
+	{
+		std::unique_lock<std::mutex> mergerLock(mergerMutex);
+		mergerRunning = false;
+	}
+
+	mergerCondition.notify_all();
+
+	if (mergerThread.joinable())
+	{
+		mergerThread.join();
 	}
+}
 
-	std::vector<std::string> formattedData = dataFormat(data);
+bool MMU::suspendIfOvercommitted(unsigned long long processID)
+{
+	size_t numFrames = maximumOverallMemory / memoryPerFrame;
 
-	if ((base + formattedData.size() - 1) > maximumOverallMemory)
+	if (activeWorkingSet <= numFrames && suspendedProcesses == 0)
 	{
-		//std::cout << "\nError: Invalid Address\n";
 		return false;
 	}
 
-	for (std::string formatted : formattedData)
+	std::unique_lock<std::mutex> evictionLock(evictionMutex);
+
+	std::shared_ptr<PageTable> table = findTable(processID);
+
+	if (!table)
 	{
-		if (physicalMemory.write(physicalMemory.convertDecToHex(base++), formatted))
-		{
-			//physicalMemory.updateFrame()
-			continue;
-		}
+		return false;
+	}
 
-		//std::cerr << "\nError: Physical Memory Write unsuccessful\n";
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+
+	if (table->suspended)
+	{
 		return false;
 	}
 
-	auto frameID = physicalMemory.getFrameID(location);
-	if (frameID)
+	bool overcommitted = activeWorkingSet > numFrames;
+	bool resident = table->references - table->activatedAt >= residencyWindows * workingSetWindow;
+
+	if (!overcommitted && !(resident && suspendedProcesses != 0))
 	{
-		Page* page = getPage(*frameID);
-		if (page)
-		{
-			page->dirty = true;
-		}
+		return false;
 	}
 
+	activeWorkingSet -= table->workingSetSize;
+	table->suspended = true;
+	suspendedProcesses++;
+
+	swapOut(*table, processID);
+
 	return true;
+}
+
+bool MMU::writeBytes(unsigned long long processID, uint32_t address, std::span<const uint8_t> data)
+{
+	std::shared_ptr<PageTable> table = findTable(processID);
+
+	if (!table)
+	{
+		std::cerr << "\nError: Process page table not contained\n";
+		return false;
+	}
+
+	std::unique_lock<std::mutex> tableLock(table->mutex);
+
+	return writeBytes(*table, processID, address, data, tableLock);
 }
\ No newline at end of file
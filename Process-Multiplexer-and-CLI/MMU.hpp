@@ -3,42 +3,186 @@
 // ----- << External Library >> ----- //
 #include "Frame.hpp"
 #include "PhysicalMemory.hpp"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <condition_variable>
+#include <thread>
 #include <unordered_map>
 
+class TLB;
+
 // ----- << Class >> ----- //
 /**
  * @brief	A class that emulates the functions of a 
  *			Memory Manager Unit
+ * 
+ *			Locking: every page table has its own lock, so accesses
+ *			to resident pages of different processes run in 
+ *			parallel. Page faults, evictions, removal and the 
+ *			flusher take evictionMutex FIRST and only then page 
+ *			table locks. A thread that holds a page table lock
+ *			without evictionMutex never waits on another MMU lock
+ * 
+ *			Page tables are two-level: a directory of second-level
+ *			tables that are only allocated once a page in their 
+ *			range is used. With huge pages enabled, every full range
+ *			of a process is mapped by one huge page held in an
+ *			aligned run of slots, and only the last partial range
+ *			uses base pages
  */
 class MMU
 {
-private:
+public:
 	/**
 	 * @brief	A structure that represents a page
 	 */
 	struct Page
 	{
+		bool backed = false;
+				// Has a slot in the backing store, otherwise the
+				// page is all zeros
 		bool dirty = false;
 		bool valid = false;
 		unsigned long long frameID = -1;
+				// Assigned on the first fault
+		size_t slot = 0;
+				// Index of the frame in physical memory while valid
+		size_t referencedWindow = 0;
+				// Last working-set window the page was referenced in
+		bool shared = false;
+				// Mapped read-only onto a frame merged with identical
+				// pages, a write copies the frame first
+		bool inherited = false;
+				// Shared, and its own backing store slot does not
+				// hold its contents yet (a forked or a dirty page),
+				// which are saved there when it leaves the frame
+		bool huge = false;
+				// Maps a whole directory range. Its frame covers
+				// pagesPerTable slots and frame IDs, starting at 
+				// slot and frameID. Never shared
+	};
+
+	/**
+	 * @brief	An entry of the directory of a page table
+	 */
+	struct DirectoryEntry
+	{
+		std::unique_ptr<Page[]> pages;
+				// The second-level table of pagesPerTable pages, or
+				// the one huge page. null until a page in the range
+				// is used
+		bool huge = false;
 	};
 
 	/**
 	 * @brief	A structure that represents a page table of an
 	 *			individual process
+	 * 
+	 *			Public so that a TLB entry can point at the table
+	 *			of the page it translates. The entry shares the 
+	 *			table, so the table of a removed process lives 
+	 *			until the entry is replaced
 	 */
 	struct PageTable
 	{
-		std::vector<Page> pages;
+		std::mutex mutex;
+				// Guards pages, the read-ahead and the working-set
+				// state
+
+		std::vector<DirectoryEntry> directory;
+				// Entry i maps pages i * pagesPerTable onwards
+		size_t numPages = 0;
 		size_t limit = 0;
+
+		unsigned long long firstFrameID = 0;
+				// Page i uses frame ID firstFrameID + i
+
+		size_t nextSequential = 0;
+		size_t readAhead = 0;
+				// A fault on nextSequential continues a sequential
+				// run and grows readAhead, any other fault resets it
+
+		std::atomic<size_t> references{ 0 };
+				// Accesses made by the process, its virtual time
+		size_t window = 0;
+				// Working-set window that referencedPages counts,
+				// window w ends at reference w * workingSetWindow
+		size_t referencedPages = 0;
+		size_t previousPages = 0;
+				// Distinct pages referenced in the current and the
+				// last complete window
+		size_t workingSetSize = 0;
+				// The larger of the two, in frames
+
+		bool suspended = false;
+				// Swapped out by load control, its working set does
+				// not count against physical memory
+		size_t activatedAt = 0;
+				// references when the process last became active
+		std::vector<size_t> swappedPages;
+				// Pages swapOut removed, in page order, restored
+				// together by swapIn
+
+		std::atomic<size_t> reservation{ 0 };
+				// Frames held for the process by admission control
+		size_t pinned = 0;
+				// Frames of the process pinned in physical memory,
+				// never more than reservation. Guarded by 
+				// evictionMutex
+
+		std::unordered_map<size_t, size_t> sharedSlots;
+				// Slot, Number of shared pages of the table mapped to
+				// the slot
+
+		std::atomic<unsigned long long> shootdownEpoch{ 0 };
+				// Advanced whenever a page of the table is unmapped,
+				// which invalidates every TLB entry of the table 
+				// cached before it
+	};
+
+private:
+	/**
+	 * @brief	A slice of the master table with its own lock
+	 */
+	struct Shard
+	{
+		std::mutex mutex;
+
+		std::unordered_map<unsigned long long, std::shared_ptr<PageTable>> tables;
+				// Process ID, Corresponding Page Table
+	};
+
+	/**
+	 * @brief	A frame that identical clean pages are merged into
+	 */
+	struct SharedFrame
+	{
+		uint64_t hash = 0;
+		std::vector<std::pair<unsigned long long, size_t>> sharers;
+				// (Process ID, Page index) of the pages mapped to it
 	};
+
+	static constexpr size_t numShards = 16;
+
+	static constexpr size_t basePagesPerTable = 64;
+			// Entries of a second-level table without huge pages
+
+	static constexpr size_t workingSetWindow = 64;
+			// References per working-set window
+	static constexpr size_t residencyWindows = 8;
+			// Windows an active process runs before it gives its
+			// frames up to a suspended one
 	
 	// Primitive Data Members
 	bool& breaker;
-	unsigned long long framesCreated;
+	bool flusherRunning;
+	bool mergerRunning;
+	std::atomic<unsigned long long> framesCreated;
 
 	// User-defined Data Members
-	size_t availableMemory;
+	std::atomic<size_t> availableMemory;
 
 	size_t limitHigh;
 
@@ -49,51 +193,230 @@ private:
 
 	size_t numFramesPerProcess;
 
-	size_t pagesIn;
-	size_t pagesOut;
+	size_t readAheadWindow;
+			// Most pages faulted in after the requested page
+
+	size_t pagesPerTable;
+			// Entries of a second-level table, and the base pages
+			// a huge page covers
+	bool hugePages;
+
+	std::atomic<size_t> pageTableMemory;
+			// Bytes held by directories and second-level tables
+
+	std::atomic<size_t> pagesIn;
+	std::atomic<size_t> pagesOut;
+
+	std::atomic<size_t> asyncWriteBacks;
+	std::atomic<size_t> syncWriteBacks;
+
+	size_t cleanHighWatermark;
+	size_t cleanLowWatermark;
+			// The flusher wakes when fewer than cleanLowWatermark
+			// frames are clean (or free) and cleans up to
+			// cleanHighWatermark
+
+	std::atomic<size_t> dirtyFrames;
+
+	std::atomic<size_t> pageFaults;
+			// Faults serviced, a read-ahead run counts once
+	std::atomic<size_t> retiredReferences;
+			// References made by removed processes
+
+	std::atomic<size_t> copyOnWrites;
+	std::atomic<size_t> mergedPages;
+	std::atomic<size_t> sharedFrameCount;
+			// Pages mapped to shared frames, and the frames
+
+	std::atomic<size_t> activeWorkingSet;
+	std::atomic<size_t> suspendedProcesses;
+			// Sum of the working sets of processes that are not
+			// suspended, and the number that are
+	std::atomic<size_t> swappedInPages;
+			// Pages restored in a batch when a process resumed
+
+	std::atomic<size_t> reservedFrames;
+			// Sum of the reservations of admitted processes, never
+			// more than the physical frames
+
+	std::condition_variable flusherCondition;
 
-	std::mutex createPageMutex;
-	std::mutex pageFaultMutex;
-	std::mutex readMutex;
-	std::mutex writeMutex;
-	std::mutex loadingMutex;
+	std::mutex evictionMutex;
+			// Guards invertedTable and the frames of physical memory
+	std::mutex flusherMutex;
 
-	std::recursive_mutex readWriteMutex;
+	std::condition_variable mergerCondition;
+	std::mutex mergerMutex;
 
-	std::string dataPlaceholder;
+	std::thread flusherThread;
+	std::thread mergerThread;
 
-	std::unordered_map<unsigned long long, PageTable> masterTable; 
-			// Process ID, Corresponding Page Table
+
+	std::array<Shard, numShards> masterTable; 
+			// Sharded by process ID
+
+	std::unordered_map<unsigned long long,
+		std::pair<unsigned long long, size_t>> invertedTable;
+			// Frame ID, (Process ID, Page index) of resident frames
+			// that are not shared
+
+	std::unordered_map<unsigned long long, SharedFrame> sharedFrames;
+			// Frame ID, Shared frame. Guarded by evictionMutex
 		
 	// Object Members
 	PhysicalMemory physicalMemory;
 
 	/**
-	 * @brief	Formats data into a vector of strings where each
-	 *			string consists of 2 characters
+	 * @brief	Gives a page that is written its own copy of the 
+	 *			shared frame it is mapped to
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of the page table
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	processID --
+	 *			The process that is writing
+	 * 
+	 * @param	pageIndex --
+	 *			The index of the shared page in the page table
+	 */
+	void copyOnWrite(
+		PageTable& table, 
+		unsigned long long processID, 
+		size_t pageIndex
+	);
+
+	/**
+	 * @brief	Services a page fault
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of the page table
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	processID --
+	 *			The process whose page is not in physical memory
+	 * 
+	 * @param	requestedPage --
+	 *			The index of the page in the page table
+	 */
+	void faultIn(
+		PageTable& table, 
+		unsigned long long processID, 
+		size_t requestedPage
+	);
+
+	/**
+	 * @brief	Services a page fault on a huge page, loading all 
+	 *			of it into an aligned run of slots
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of the page table
 	 * 
-	 * @param	raw --
-	 *			The string of hexadecimal characters that is going
-	 *			to be formatted
+	 * @param	table --
+	 *			The page table of the process
 	 * 
-	 * @return	A vector containing the formatted strings
+	 * @param	processID --
+	 *			The process whose page is not in physical memory
+	 * 
+	 * @param	requestedPage --
+	 *			The index of the first base page the huge page
+	 *			covers
 	 */
-	std::vector<std::string> dataFormat(std::string raw);
+	void faultInHuge(
+		PageTable& table, 
+		unsigned long long processID, 
+		size_t requestedPage
+	);
 
 	/**
-	 * @brief	Get the page that has the corresponding frameID
+	 * @brief	Finds the page that maps a page index
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
 	 * 
-	 * @param	ID --
-	 *			The frameID of the page being searched
+	 * @param	table --
+	 *			The page table of the process
 	 * 
-	 * @return	A pointer to the page
+	 * @param	pageIndex --
+	 *			The index of a base page of the process
+	 * 
+	 * @return	The page, which is the huge page for an index in a
+	 *			huge range. nullptr if its second-level table was
+	 *			never allocated, so the page is an unbacked zero
+	 *			page
 	 */
-	Page* getPage(unsigned long long ID);
+	Page* findPage(PageTable& table, size_t pageIndex);
+
+	/**
+	 * @brief	Finds the page that maps a page index, allocating
+	 *			its second-level table if needed
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	pageIndex --
+	 *			The index of a base page of the process
+	 * 
+	 * @return	The page, which is the huge page for an index in a
+	 *			huge range
+	 */
+	Page& getPage(PageTable& table, size_t pageIndex);
+
+	/**
+	 * @brief	Get the slot that holds a base page of a resident
+	 *			page
+	 * 
+	 * @param	page --
+	 *			The resident page
+	 * 
+	 * @param	pageIndex --
+	 *			The index of the base page
+	 * 
+	 * @return	The index of the slot in physical memory
+	 */
+	size_t getSlot(const Page& page, size_t pageIndex) const;
+
+	/**
+	 * @brief	Get the index of the next page after pageIndex that
+	 *			has its own entry, skipping huge ranges and ranges
+	 *			without a second-level table
+	 * 
+	 *			Walking a table from 0 with it visits every page
+	 *			that exists once
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
+	 */
+	size_t nextPage(const PageTable& table, size_t pageIndex) const;
+
+	/**
+	 * @brief	Frees the second-level tables of a process that is 
+	 *			removed
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
+	 */
+	void releaseTables(PageTable& table);
+
+	/**
+	 * @brief	Finds the page table of a process
+	 * 
+	 * @param	processID --
+	 *			ID of the process
+	 * 
+	 * @return	The page table. nullptr if the process has none
+	 */
+	std::shared_ptr<PageTable> findTable(unsigned long long processID);
 
 	/**
 	 * @brief	Get the index of a page in a page table give
 	 *			a frameID
 	 * 
+	 *			WARNING: Caller must hold evictionMutex
+	 * 
 	 * @param	frameID --
 	 *			The frameID of the page being search for
 	 * 
@@ -102,49 +425,453 @@ private:
 	size_t getPageIndex(unsigned long long ID);
 
 	/**
-	 * @brief	Checks if the page is valid given a frameID
-	 *
+	 * @brief	Writes dirty resident frames to the backing store
+	 *			until cleanHighWatermark frames are clean
+	 * 
+	 *			The frames are copied and marked clean under 
+	 *			evictionMutex, and then written after it is
+	 *			released. The backing store lock is held across the
+	 *			hand-off so a page in of a frame waits for its write
+	 */
+	void flushDirtyFrames();
+
+	/**
+	 * @brief	Background write-back loop, cleans dirty frames
+	 *			ahead of eviction so victims are normally clean
+	 */
+	void flusherFunction();
+
+	/**
+	 * @brief	Hashes the contents of a frame
+	 * 
+	 * @param	data --
+	 *			Source of memoryPerFrame bytes
+	 * 
+	 * @return	The FNV-1a hash of the frame
+	 */
+	uint64_t hashFrame(const uint8_t* data) const;
+
+	/**
+	 * @brief	Scans the resident frames and merges clean pages
+	 *			with identical contents into one shared frame,
+	 *			freeing the other frames
+	 * 
+	 *			Only clean pages are merged, since their contents
+	 *			are also in the backing store (or they are zero
+	 *			pages), so a shared frame is evicted by invalidating
+	 *			its sharers without a write
+	 */
+	void mergeFrames();
+
+	/**
+	 * @brief	Background merging loop
+	 */
+	void mergerFunction();
+
+	/**
+	 * @brief	Loads a page into a slot, from the backing store if
+	 *			it is backed. Otherwise, as a zero frame
+	 * 
+	 * @param	page --
+	 *			The page being loaded
+	 * 
+	 * @param	index --
+	 *			The index of the slot in physical memory
+	 * 
+	 * @param	data --
+	 *			The frame data if it was already read from the
+	 *			backing store. Otherwise, nullptr
+	 */
+	void loadPage(Page& page, size_t index, const uint8_t* data);
+
+	/**
+	 * @brief	Evicts the frame that starts at a slot, invalidating
+	 *			the pages mapped to it and writing it back if it is
+	 *			dirty. The slot keeps the frame until the caller
+	 *			reuses or removes it
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of faultingTable
+	 * 
+	 * @param	victimKey --
+	 *			The first slot of the frame
+	 * 
+	 * @param	faultingTable --
+	 *			The page table being loaded into, which is not
+	 *			locked again if a page of it is invalidated
+	 * 
+	 * @return	The ID of the evicted frame. null if the slot holds
+	 *			no frame
+	 */
+	std::optional<unsigned long long> evictSlot(
+		size_t victimKey, 
+		PageTable& faultingTable
+	);
+
+	/**
+	 * @brief	Finds an aligned run of slots for a huge page that
+	 *			is being loaded, evicting every frame in the run of
+	 *			the victim if no run is free
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of faultingTable
+	 * 
+	 * @param	faultingTable --
+	 *			The page table being loaded into
+	 * 
+	 * @return	The first slot of the run. null if no run could be
+	 *			freed
+	 */
+	std::optional<size_t> obtainRun(PageTable& faultingTable);
+
+	/**
+	 * @brief	Finds a slot for a page that is being loaded, 
+	 *			evicting a victim if physical memory is full
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of faultingTable
+	 * 
+	 * @param	faultingTable --
+	 *			The page table being loaded into, which is not
+	 *			locked again if the victim belongs to it
+	 * 
+	 * @return	The index of the slot. null if no slot could be
+	 *			freed
+	 */
+	std::optional<size_t> obtainSlot(PageTable& faultingTable);
+
+	/**
+	 * @brief	obtainSlot for read-ahead, which gives up instead of
+	 *			evicting a frame loaded earlier in the same batch
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of faultingTable
+	 * 
+	 * @param	faultingTable --
+	 *			The page table being loaded into
+	 * 
+	 * @param	batchFrameID --
+	 *			The frame ID of the first page of the batch
+	 * 
+	 * @param	batchCount --
+	 *			The number of pages of the batch loaded so far, 
+	 *			with consecutive frame IDs
+	 * 
+	 * @return	The index of the slot. null if no slot could be
+	 *			freed or the victim is part of the batch, which
+	 *			then stays resident
+	 */
+	std::optional<size_t> obtainSlot(
+		PageTable& faultingTable,
+		unsigned long long batchFrameID,
+		size_t batchCount
+	);
+
+	/**
+	 * @brief	Pins a private frame that was just loaded if the 
+	 *			reservation of its process has room for it, so 
+	 *			admitted processes keep their reserved frames
+	 * 
+	 *			WARNING: Caller must hold evictionMutex
+	 * 
+	 * @param	table --
+	 *			The page table of the process that owns the frame
+	 * 
+	 * @param	slot --
+	 *			The first slot of the frame
+	 */
+	void pinFrame(PageTable& table, size_t slot);
+
+	/**
+	 * @brief	Gives the reservation of a process back the frame
+	 *			that is leaving it, if the frame is pinned
+	 * 
+	 *			WARNING: Caller must hold evictionMutex
+	 * 
+	 * @param	table --
+	 *			The page table of the process that owns the frame
+	 * 
+	 * @param	slot --
+	 *			The first slot of the frame
+	 * 
+	 * @return	true if the frame is pinned. Otherwise, false.
+	 */
+	bool releasePin(PageTable& table, size_t slot);
+
+	/**
+	 * @brief	Caches the translation of a resident page in a TLB
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
+	 * 
+	 * @param	tlb --
+	 *			The TLB of the Core that made the access
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	processID --
+	 *			The process that owns the page
+	 * 
+	 * @param	pageIndex --
+	 *			The index of the page in the page table
+	 */
+	void fillTLB(
+		TLB& tlb, 
+		std::shared_ptr<PageTable> table,
+		unsigned long long processID, 
+		size_t pageIndex
+	);
+
+	/**
+	 * @brief	Records a reference to a page in the working set of
+	 *			the process, closing the working-set window once
+	 *			workingSetWindow references passed
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	pageIndex --
+	 *			The index of the page in the page table
+	 */
+	void reference(PageTable& table, size_t pageIndex);
+
+	/**
+	 * @brief	Sets the working set of a process and keeps the
+	 *			active working set in step
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	size --
+	 *			The new working set, in frames
+	 */
+	void setWorkingSetSize(PageTable& table, size_t size);
+
+	/**
+	 * @brief	Turns the private resident frame of a page into a
+	 *			shared frame that the page is the only sharer of
+	 * 
+	 *			A dirty page is marked clean and inherited, so the
+	 *			frame can be dropped like any other shared frame
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of the page table
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	processID --
+	 *			The process that owns the page
+	 * 
+	 * @param	pageIndex --
+	 *			The index of the resident page in the page table
+	 * 
+	 * @param	hash --
+	 *			The hash of the contents of the frame
+	 * 
+	 * @return	The shared frame
+	 */
+	std::unordered_map<unsigned long long, SharedFrame>::iterator shareFrame(
+		PageTable& table,
+		unsigned long long processID,
+		size_t pageIndex,
+		uint64_t hash
+	);
+
+	/**
+	 * @brief	Invalidates the TLB entries of every Core that
+	 *			translate pages of a page table
+	 * 
+	 * @param	table --
+	 *			The page table whose pages were unmapped
+	 */
+	void shootdown(PageTable& table);
+
+	/**
+	 * @brief	Unmaps a page from its shared frame, freeing the
+	 *			frame once it has no sharers left. The page is left
+	 *			invalid
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of the page table
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	processID --
+	 *			The process that owns the page
+	 * 
+	 * @param	pageIndex --
+	 *			The index of the shared page in the page table
+	 */
+	void unshare(
+		PageTable& table, 
+		unsigned long long processID, 
+		size_t pageIndex
+	);
+
+	/**
+	 * @brief	Swaps every resident page of a process out at once,
+	 *			writing the dirty ones back in page order
+	 * 
+	 *			WARNING: Caller must hold evictionMutex and the lock
+	 *			of the page table
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	processID --
+	 *			The process that owns the page table
+	 */
+	void swapOut(PageTable& table, unsigned long long processID);
+
+	/**
+	 * @brief	Sets the dirty bit of a page and keeps the dirty
+	 *			frame count in step, waking the flusher when clean
+	 *			frames run low
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
+	 * 
+	 * @param	page --
+	 *			The page whose dirty bit is set
+	 * 
+	 * @param	dirty --
+	 *			The new value of the dirty bit
+	 */
+	void setDirty(Page& page, bool dirty);
+
+	/**
+	 * @brief	Translates a process address into a physical memory
+	 *			address, servicing a page fault if the page is not
+	 *			in physical memory
+	 * 
+	 *			The page table lock is dropped while evictionMutex
+	 *			is taken for a fault or a copy-on-write, and is held
+	 *			again on return, so the physical address stays 
+	 *			valid until the caller releases it
+	 * 
+	 * @param	table --
+	 *			The page table of the process
+	 * 
 	 * @param	processID --
-	 *			ID of the process whose page table is being used
-	 *			as a reference
+	 *			ID of the process whose page table is used
+	 * 
+	 * @param	address --
+	 *			Virtual address being translated
+	 * 
+	 * @param	tableLock --
+	 *			The held lock of the page table
+	 * 
+	 * @param	forWrite --
+	 *			true if the address is written, which copies a
+	 *			shared page first
+	 * 
+	 * @return	The physical address. null if the address is 
+	 *			outside of the process memory.
+	 */
+	std::optional<size_t> translate(
+		PageTable& table,
+		unsigned long long processID,
+		uint32_t address,
+		std::unique_lock<std::mutex>& tableLock,
+		bool forWrite
+	);
+
+	/**
+	 * @brief	Copies bytes out of the memory of a process. The
+	 *			access may cross pages, each page touched is 
+	 *			translated once and its bytes copied at once
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
 	 *
-	 * @param	frameID --
-	 *			ID of the frame being checked
+	 * @param	table --
+	 *			The page table of the process
+	 * 
+	 * @param	processID --
+	 *			The process that owns the page table
+	 * 
+	 * @param	address --
+	 *			Virtual address of the first byte read
+	 * 
+	 * @param	buffer --
+	 *			Destination of the bytes read
+	 * 
+	 * @param	tableLock --
+	 *			The held lock of the page table, released while a
+	 *			fault waits for evictionMutex
 	 *
-	 * @return	true if the page is valid (in the physical
-	 *			memory). Otherwise, true.
+	 * @return	true if every byte was read. Otherwise, false.
 	 */
-	bool isValid(
+	bool readBytes(
+		PageTable& table,
 		unsigned long long processID,
-		unsigned long long frameID
+		uint32_t address,
+		std::span<uint8_t> buffer,
+		std::unique_lock<std::mutex>& tableLock
 	);
 
 	/**
-	 * @brief	Checks if a process is accessing the correct frame
+	 * @brief	Copies bytes into the memory of a process. The
+	 *			access may cross pages, each page touched is 
+	 *			translated once, its bytes copied at once, and it
+	 *			is marked dirty
+	 * 
+	 *			WARNING: Caller must hold the lock of the page table
 	 *
+	 * @param	table --
+	 *			The page table of the process
+	 * 
 	 * @param	processID --
-	 *			The ID of the process attempting to access memory
-	 *
-	 * @param	physicalMemoryLocation --
-	 *			Loation in the physical memory that the process
-	 *			is attempting to access
+	 *			The process that owns the page table
+	 * 
+	 * @param	address --
+	 *			Virtual address of the first byte written
+	 * 
+	 * @param	data --
+	 *			The bytes written
+	 * 
+	 * @param	tableLock --
+	 *			The held lock of the page table, released while a
+	 *			fault waits for evictionMutex
 	 *
-	 * @return	true if it is accessing a frame that the process
-	 *			owns. Otherwise, false.
+	 * @return	true if every byte was written. Otherwise, false.
 	 */
-	bool validAccess(
+	bool writeBytes(
+		PageTable& table,
 		unsigned long long processID,
-		size_t physicalMemoryLocation
+		uint32_t address,
+		std::span<const uint8_t> data,
+		std::unique_lock<std::mutex>& tableLock
 	);
+
 public:
 	/**
 	 * @brief	Class constructor
+	 * 
+	 * @param	backingStorePath --
+	 *			File that backs the swapped out frames
+	 * 
+	 * @param	hugePageSize --
+	 *			Exponent of the huge page size. Huge pages are off
+	 *			if it is not larger than memoryPerFrame or a huge
+	 *			page would take more than a quarter of physical
+	 *			memory
 	 */
 	MMU(
 		size_t maximumMemoryPerProcess,
 		size_t maximumOverallMemory,
 		size_t memorPerFrame,
 		size_t minimumMemoryPerProcess,
+		std::string pageReplacement,
+		std::string backingStoreMode,
+		std::string backingStorePath,
+		size_t readAheadWindow,
+		size_t compressedPoolSize,
+		size_t hugePageSize,
 		bool& breaker
 	);
 
@@ -153,6 +880,36 @@ public:
 	 */
 	~MMU();
 
+	/**
+	 * @brief	Load control at dispatch. Resumes a suspended process
+	 *			if its working set fits in the frames left by the
+	 *			active processes, or if no other process is active
+	 * 
+	 * @param	processID --
+	 *			ID of the process being dispatched
+	 * 
+	 * @return	true if the process may run. Otherwise, false and it
+	 *			stays suspended.
+	 */
+	bool activate(unsigned long long processID);
+
+	/**
+	 * @brief	Swaps a resumed process back in as a unit. The pages
+	 *			swapOut removed are restored in page order, each
+	 *			run of consecutive frame IDs read from the backing
+	 *			store at once, so the process does not fault them
+	 *			back one at a time
+	 * 
+	 *			Only free frames are used, the pages that do not fit
+	 *			and huge pages are left to demand paging
+	 * 
+	 * @param	processID --
+	 *			ID of the process that activate resumed
+	 * 
+	 * @return	The number of pages swapped in
+	 */
+	size_t swapIn(unsigned long long processID);
+
 	/**
 	 * @brief	Counts how many frames a process owns that are
 	 *			currently contained in physical memory
@@ -180,6 +937,11 @@ public:
 	 *			created or scheduler by the CPU but has a 
 	 *			specified amount of memory that it consumes
 	 * 
+	 *			Pages start as unbacked zero pages. No frame ID or
+	 *			backing store slot is used until the first fault.
+	 *			A process that already has pages (a forked one) 
+	 *			keeps them
+	 * 
 	 * @param	processID --
 	 *			ID of the process that the MMU will create pages and
 	 *			frames for
@@ -193,6 +955,68 @@ public:
 		size_t requriedMemory
 	);
 
+	/**
+	 * @brief	Writes the backing store as a text file of
+	 *			"ID HEXDATA" lines for debugging
+	 * 
+	 * @param	path --
+	 *			The text file that is written
+	 * 
+	 * @return	The number of frames exported
+	 */
+	size_t exportBackingStore(const std::string& path);
+
+	/**
+	 * @brief	Admission control. Reserves frames for a new process
+	 *			and creates its pages if the reservation fits in 
+	 *			the physical frames not yet reserved
+	 * 
+	 *			The reservation is the smaller of frames and the
+	 *			pages of the process, and is released by remove
+	 * 
+	 * @param	processID --
+	 *			ID of the process being admitted
+	 * 
+	 * @param	requiredMemory --
+	 *			The amount of memory that the Process requires to
+	 *			operate
+	 * 
+	 * @param	frames --
+	 *			The minimum number of frames a process is
+	 *			guaranteed, 0 admits every process
+	 * 
+	 * @return	true if the process was admitted. Otherwise, false
+	 *			and nothing is reserved
+	 */
+	bool reserveFrames(
+		unsigned long long processID,
+		size_t requiredMemory,
+		size_t frames
+	);
+
+	/**
+	 * @brief	Gives a forked process a copy of the pages of its
+	 *			parent
+	 * 
+	 *			Resident pages are mapped copy-on-write onto shared
+	 *			frames with the parent, so a frame is only copied
+	 *			when either process writes it. Swapped out pages
+	 *			are copied into the backing store slots of the 
+	 *			child
+	 * 
+	 * @param	parentID --
+	 *			ID of the process being forked
+	 * 
+	 * @param	childID --
+	 *			ID of the new process, which has no pages yet
+	 * 
+	 * @return	true if the pages were copied. Otherwise, false
+	 */
+	bool forkPages(
+		unsigned long long parentID, 
+		unsigned long long childID
+	);
+
 	/**
 	 * @brief	Get the available memory the MMU has
 	 * 
@@ -200,6 +1024,110 @@ public:
 	 */
 	size_t getAvailableMemory() const;
 
+	/**
+	 * @brief	Get the sum of the working sets of the processes that
+	 *			are not suspended
+	 * 
+	 * @return	The active working set, in frames
+	 */
+	size_t getActiveWorkingSet() const;
+
+	/**
+	 * @brief	Get the compression ratio of the swap pool
+	 * 
+	 * @return	Uncompressed over compressed bytes of the pooled
+	 *			frames. 0 if the pool is empty
+	 */
+	double getCompressionRatio();
+
+	/**
+	 * @brief	Get the number of shared pages that were written and
+	 *			given their own frame
+	 * 
+	 * @return	The number of copy-on-writes
+	 */
+	size_t getCopyOnWrites() const;
+
+	/**
+	 * @brief	Get the number of page faults per 1000 references,
+	 *			over every process that has had a page table
+	 * 
+	 * @return	The system-wide fault rate
+	 */
+	double getFaultRate();
+
+	/**
+	 * @brief	Get the number of pages mapped to shared frames
+	 * 
+	 * @return	The number of merged pages
+	 */
+	size_t getMergedPages() const;
+
+	/**
+	 * @brief	Get the number of page faults serviced
+	 * 
+	 * @return	The number of page faults
+	 */
+	size_t getPageFaults() const;
+
+	/**
+	 * @brief	Get the memory used by the page tables of every
+	 *			process
+	 * 
+	 * @return	The bytes held by directories and allocated
+	 *			second-level tables
+	 */
+	size_t getPageTableMemory() const;
+
+	/**
+	 * @brief	Get the number of frames paged in from the swap pool
+	 *			without file I/O
+	 * 
+	 * @return	The number of swap pool hits
+	 */
+	size_t getSwapPoolHits() const;
+
+	/**
+	 * @brief	Get the number of frames that identical pages were
+	 *			merged into
+	 * 
+	 * @return	The number of shared frames
+	 */
+	size_t getSharedFrames() const;
+
+	/**
+	 * @brief	Get the number of processes suspended by load control
+	 * 
+	 * @return	The number of suspended processes
+	 */
+	size_t getSuspendedProcesses() const;
+
+	/**
+	 * @brief	Get the number of pages restored by swapIn
+	 * 
+	 * @return	The number of pages swapped in as a batch
+	 */
+	size_t getSwappedInPages() const;
+
+	/**
+	 * @brief	Get the number of frames reserved by admission
+	 *			control
+	 * 
+	 * @return	The sum of the reservations of admitted processes
+	 */
+	size_t getReservedFrames() const;
+
+	/**
+	 * @brief	Get the working set of a process
+	 * 
+	 * @param	processID --
+	 *			ID of the process
+	 * 
+	 * @return	The distinct pages referenced in the last working-set
+	 *			window, in frames. 0 if the process has no page table
+	 */
+	size_t getWorkingSetSize(unsigned long long processID);
+
 	/**
 	 * @brief	Get the number of pages the MMU had to load from
 	 *			the backing store
@@ -208,6 +1136,22 @@ public:
 	 */
 	size_t getPagesIn() const;
 
+	/**
+	 * @brief	Get the number of dirty frames written back by the
+	 *			background flusher
+	 * 
+	 * @return	The number of asynchronous write-backs
+	 */
+	size_t getAsyncWriteBacks() const;
+
+	/**
+	 * @brief	Get the number of dirty victims written back while
+	 *			a page fault waited
+	 * 
+	 * @return	The number of synchronous write-backs
+	 */
+	size_t getSyncWriteBacks() const;
+
 	/**
 	 * @brief	Get the number of pages the MMU had to store into
 	 *			the backing store (from page faults and 
@@ -223,6 +1167,11 @@ public:
 	 * 
 	 *			WARNING: Does not take into account a Hit or Miss
 	 * 
+	 *			When the fault continues a sequential run of the
+	 *			process, the following non-resident pages are 
+	 *			loaded as well, up to the read-ahead window, with
+	 *			one backing store read for the whole run
+	 * 
 	 * @param	processID --
 	 *			The process whose page is not currently in physical
 	 *			memory
@@ -257,7 +1206,8 @@ public:
 	void printMasterTable();
 
 	/**
-	 * @brief	Reada data at the address based on process memory
+	 * @brief	Reads a 16-bit value at the address based on process
+	 *			memory
 	 * 
 	 *			0x0000 does not necessarily translate to the 0x0000
 	 *			address in the physical memory. It can be at the 
@@ -269,6 +1219,51 @@ public:
 	 *			physical memory
 	 *
 	 * @param	address --
+	 *			Virtual address of the first of the 2 bytes read
+	 *
+	 * @return	The value read if the read operation is successful.
+	 *			Otherwise, null.
+	 */
+	std::optional<uint16_t> protectedRead(
+		unsigned long long processID,
+		uint32_t address
+	);
+
+	/**
+	 * @brief	protectedRead through the TLB of a Core
+	 * 
+	 *			A hit skips the master table and the page lookup but
+	 *			still takes the page table lock of the process, so
+	 *			the slot cannot be evicted mid-read
+	 *
+	 * @param	processID --
+	 *			ID of the process that is trying to read from the
+	 *			physical memory
+	 *
+	 * @param	address --
+	 *			Virtual address of the first of the 2 bytes read
+	 * 
+	 * @param	tlb --
+	 *			The TLB of the Core that is reading
+	 *
+	 * @return	The value read if the read operation is successful.
+	 *			Otherwise, null.
+	 */
+	std::optional<uint16_t> protectedRead(
+		unsigned long long processID,
+		uint32_t address,
+		TLB& tlb
+	);
+
+	/**
+	 * @brief	Hexadecimal string wrapper of protectedRead for
+	 *			the command line
+	 *
+	 * @param	processID --
+	 *			ID of the process that is trying to read from the
+	 *			physical memory
+	 *
+	 * @param	address --
 	 *			Hexadecimal address for the read operation
 	 *
 	 *			Serves as the starting address if data is larger
@@ -277,9 +1272,8 @@ public:
 	 * @param	bytesToRead --
 	 *			The number of bytes to read from the physical memory
 	 *
-	 * @return	The bytes read if the read operation is successful.
-	 *			Otherwise, null.
-
+	 * @return	The bytes read as hexadecimal characters if the read 
+	 *			operation is successful. Otherwise, null.
 	 */
 	std::optional<std::string> protectedRead(
 		unsigned long long processID,
@@ -288,7 +1282,8 @@ public:
 	);
 
 	/**
-	 * @brief	Writes data at the address based on process memory
+	 * @brief	Writes a 16-bit value at the address based on 
+	 *			process memory
 	 * 
 	 *			0x0000 does not necessarily translate to the 0x0000
 	 *			address in the physical memory. It can be at the 
@@ -300,6 +1295,60 @@ public:
 	 *			physical memory
 	 *
 	 * @param	address --
+	 *			Virtual address of the first of the 2 bytes written
+	 *
+	 * @param	data --
+	 *			The value that is being written into memory
+	 *
+	 * @return	true if the write operation is successful.
+	 *			Otherwise, false.
+	 */
+	bool protectedWrite(
+		unsigned long long processID,
+		uint32_t address,
+		uint16_t data
+	);
+
+	/**
+	 * @brief	protectedWrite through the TLB of a Core
+	 * 
+	 *			A hit skips the master table and the page lookup but
+	 *			still takes the page table lock of the process,
+	 *			since the page is marked dirty and the slot must not
+	 *			be evicted mid-write
+	 *
+	 * @param	processID --
+	 *			ID of the process that is trying to write into
+	 *			physical memory
+	 *
+	 * @param	address --
+	 *			Virtual address of the first of the 2 bytes written
+	 *
+	 * @param	data --
+	 *			The value that is being written into memory
+	 * 
+	 * @param	tlb --
+	 *			The TLB of the Core that is writing
+	 *
+	 * @return	true if the write operation is successful.
+	 *			Otherwise, false.
+	 */
+	bool protectedWrite(
+		unsigned long long processID,
+		uint32_t address,
+		uint16_t data,
+		TLB& tlb
+	);
+
+	/**
+	 * @brief	Hexadecimal string wrapper of protectedWrite for
+	 *			the command line
+	 *
+	 * @param	processID --
+	 *			ID of the process that is trying to write into
+	 *			physical memory
+	 *
+	 * @param	address --
 	 *			Hexadecimal address for the write operation.
 	 *
 	 *			Serves as the starting address if data is larger
@@ -320,29 +1369,28 @@ public:
 	);
 
 	/**
-	 * @brief	Reada data at the address based on physical memory
-	 *			addresses
+	 * @brief	Reads bytes at a virtual address of a process. An
+	 *			access that crosses pages is split at the page
+	 *			boundaries, so a 16-bit value costs one translation
+	 *			and one copy unless it straddles two pages
 	 * 
 	 * @param	processID --
 	 *			ID of the process that is trying to read from the 
 	 *			physical memory
 	 * 
 	 * @param	address --
-	 *			Hexadecimal address for the read operation
+	 *			Virtual address of the first byte read
 	 * 
-	 *			Serves as the starting address if data is larger
-	 *			than 1 byte (2 hexadecimal characters)
+	 * @param	buffer --
+	 *			Destination of the bytes read
 	 * 
-	 * @param	bytesToRead --
-	 *			The number of bytes to read from the physical memory
-	 * 
-	 * @return	The bytes read if the read operation is successful.
-	 *			Otherwise, null.
+	 * @return	true if the read operation is successful.
+	 *			Otherwise, false.
 	 */
-	std::optional<std::string> read(
+	bool readBytes(
 		unsigned long long processID,
-		std::string address,
-		size_t bytesToRead
+		uint32_t address,
+		std::span<uint8_t> buffer
 	);
 
 	/**
@@ -355,27 +1403,52 @@ public:
 	void remove(unsigned long long processID);
 
 	/**
-	 * @brief	Writes data at the address based on physical memory
-	 *			addresses
+	 * @brief	Load control after a time slice. Suspends the process
+	 *			and swaps it out as a unit when the active working
+	 *			set exceeds physical memory, so the processes left
+	 *			keep their working sets resident instead of 
+	 *			thrashing
+	 * 
+	 *			A process that has been active for residencyWindows
+	 *			is also suspended while other processes are, so the
+	 *			suspended ones get their turn
+	 * 
+	 * @param	processID --
+	 *			ID of the process whose time slice ended
+	 * 
+	 * @return	true if the process was suspended. Otherwise, false.
+	 */
+	bool suspendIfOvercommitted(unsigned long long processID);
+
+	/**
+	 * @brief	Stops the flusher and the merger for good. Dirty
+	 *			frames are then only written back on eviction and
+	 *			identical pages are no longer merged
+	 */
+	void stopBackgroundThreads();
+
+	/**
+	 * @brief	Writes bytes at a virtual address of a process. An
+	 *			access that crosses pages is split at the page
+	 *			boundaries, so a 16-bit value costs one translation
+	 *			and one copy unless it straddles two pages
 	 * 
 	 * @param	processID --
 	 *			ID of the process that is trying to write into
 	 *			physical memory
 	 * 
 	 * @param	address --
-	 *			Hexadecimal address for the write operation.
-	 *		
-	 *			Serves as the starting address if data is more than
-	 *			1 byte (2 hexadecimal characters)
+	 *			Virtual address of the first byte written
 	 * 
 	 * @param	data --
-	 *			The data that is being written into memory
+	 *			The bytes that are being written into memory
 	 * 
 	 * @return	true if the write operation is successful.
 	 *			Otherwise, false.
 	 */
-	bool write(unsigned long long processID, 
-		std::string address, 
-		std::string data
+	bool writeBytes(
+		unsigned long long processID, 
+		uint32_t address, 
+		std::span<const uint8_t> data
 	);
 };
\ No newline at end of file
@@ -9,6 +9,13 @@ PCB::PCB(unsigned long long ID, size_t heapSize, std::vector<std::unique_ptr<Ins
 	processName = std::to_string(ID);
 }
 
+PCB::PCB(unsigned long long ID, size_t heapSize, const PCB& parent)
+	: processID(ID), processState(PROCESS_STATE::NEW), programCounter(parent.programCounter),
+	priority(parent.priority), process(ID, heapSize, parent.process), memoryRequired(parent.memoryRequired)
+{
+	processName = std::to_string(ID);
+}
+
 PCB::~PCB() = default;
 
 void PCB::appendLog(std::string log)
@@ -16,6 +23,11 @@ void PCB::appendLog(std::string log)
 	processLog += log + "\n";
 }
 
+size_t PCB::getAdmissionDelay() const
+{
+	return admissionDelay;
+}
+
 std::string PCB::getLog() const
 {
 	return processLog;
@@ -61,11 +73,21 @@ void PCB::incrementProgramCounter()
 	programCounter++;
 }
 
+void PCB::setAdmittedAt(size_t tick)
+{
+	admissionDelay = tick - queuedAt;
+}
+
 void PCB::setName(std::string name)
 {
 	processName = name;
 }
 
+void PCB::setQueuedAt(size_t tick)
+{
+	queuedAt = tick;
+}
+
 void PCB::setState(PROCESS_STATE newState)
 {
 	processState = newState;
@@ -22,6 +22,7 @@ public:
 		READY,
 		RUNNING,
 		WAITING,
+		SUSPENDED,
 		TERMINATED
 	};
 
@@ -34,6 +35,11 @@ private:
 	size_t priority;
 	size_t programCounter;
 
+	size_t queuedAt = 0;
+	size_t admissionDelay = 0;
+			// Tick the process entered the admission queue, and the
+			// ticks it waited there before it was admitted
+
 	std::string processLog = "Log:\n";
 	std::string processName;
 
@@ -54,6 +60,25 @@ public:
 		size_t memoryRequired
 	);
 
+	/**
+	 * @brief	Fork constructor. The forked process continues from
+	 *			the program counter of the parent
+	 * 
+	 * @param	ID --
+	 *			The ID of the forked process
+	 * 
+	 * @param	heapSize --
+	 *			The size of the heap of the forked process
+	 * 
+	 * @param	parent --
+	 *			The PCB of the process that is forked
+	 */
+	PCB(
+		unsigned long long ID,
+		size_t heapSize,
+		const PCB& parent
+	);
+
 	/**
 	 * @brief	Class destructor
 	 */
@@ -67,6 +92,13 @@ public:
 	 */
 	void appendLog(std::string log);
 
+	/**
+	 * @brief	Get the time the process waited for admission
+	 * 
+	 * @return	The ticks between being queued and being admitted
+	 */
+	size_t getAdmissionDelay() const;
+
 	/**
 	 * @brief	Get the log
 	 * 
@@ -129,6 +161,14 @@ public:
 	 */
 	void incrementProgramCounter();
 
+	/**
+	 * @brief	Records the admission of the process
+	 * 
+	 * @param	tick --
+	 *			The tick the process was admitted on
+	 */
+	void setAdmittedAt(size_t tick);
+
 	/**
 	 * @brief	Set the processName field of the PCB to a string
 	 * 
@@ -137,6 +177,15 @@ public:
 	 */
 	void setName(std::string name);
 
+	/**
+	 * @brief	Records when the process entered the admission
+	 *			queue
+	 * 
+	 * @param	tick --
+	 *			The tick the process was queued on
+	 */
+	void setQueuedAt(size_t tick);
+
 	/**
 	 * @brief	Set the state field of the PCB
 	 * 
@@ -1,140 +1,186 @@
 // ----- << External Library >> ----- //
 #include "PhysicalMemory.hpp"
+#include <bit>
 #include <chrono>
-#include <fstream>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <thread>
 
 // ----- << Private Member Function Implementation >> ----- //
-std::optional< std::string> PhysicalMemory::compileFrameData(unsigned long long ID)
+bool PhysicalMemory::isRunFree(size_t index, size_t count) const
 {
-	for (size_t i = 0; i < numFrames; i++)
+	if (count < 64)
 	{
-		if (frames[i] && frames[i]->getID() == ID)
-		{
-			std::ostringstream compiled;
-			for (size_t k = 0; k < frameSize; k++)
-			{
-				compiled << frames[i]->read(convertDecToHex(k));
-			}
+		uint64_t mask = ((uint64_t(1) << count) - 1) << (index % 64);
 
-			return compiled.str();
+		return (freeBitmap[index / 64] & mask) == mask;
+	}
+
+	for (size_t word = index / 64; word < (index + count) / 64; word++)
+	{
+		if (freeBitmap[word] != ~uint64_t(0))
+		{
+			return false;
 		}
 	}
 
-	return std::nullopt;
+	return true;
 }
 
-
-std::vector<std::string> PhysicalMemory::parseData(std::string raw) const
+void PhysicalMemory::claimSlot(size_t index)
 {
-	if (raw.size() % 2 != 0)
-	{
-		throw std::runtime_error("\nERROR: Backing store data corrupted\n");
-	}
+	std::unique_lock<std::mutex> freeFrameLock(freeFrameMutex);
 
-	if (raw.size() / 2 > frameSize)
+	size_t word = index / 64;
+	uint64_t bit = uint64_t(1) << (index % 64);
+
+	if (!(freeBitmap[word] & bit))
 	{
-		throw std::runtime_error("\nERROR: Backing store data exceeds allowable hex digits\n");
+		return;
 	}
 
-	std::vector<std::string> chunks;
+	freeBitmap[word] &= ~bit;
+	freeFrames--;
 
-	for (size_t i = 0; i < raw.size(); i += 2)
+	if (freeBitmap[word] == 0)
 	{
-		chunks.push_back(raw.substr(i, 2));
+		freeSummary[word / 64] &= ~(uint64_t(1) << (word % 64));
 	}
-
-	return chunks;
 }
 
-std::optional<std::string> PhysicalMemory::readBackingStore(unsigned long long ID)
+void PhysicalMemory::releaseSlot(size_t index)
 {
-	std::unique_lock<std::recursive_mutex> readBackingStoreLock(backingStoreMutex);
+	std::unique_lock<std::mutex> freeFrameLock(freeFrameMutex);
 
-	std::ifstream input("backing-store.txt");
+	size_t word = index / 64;
+	uint64_t bit = uint64_t(1) << (index % 64);
 
-	if (!input)
+	if (freeBitmap[word] & bit)
 	{
-		std::cerr << "ERROR: Cannot open backing-store.txt for readBackingStore\n\n";
-		throw std::runtime_error("Error: Cannot open the backing-store.txt for readBackingStore\n");
+		return;
 	}
 
-	std::string line;
-	while (std::getline(input, line))
+	freeBitmap[word] |= bit;
+	freeFrames++;
+
+	freeSummary[word / 64] |= uint64_t(1) << (word % 64);
+}
+
+void PhysicalMemory::drainTouches()
+{
 	{
-		unsigned long long existingID;
-		std::string existingData;
+		std::unique_lock<std::mutex> touchLock(touchMutex);
 
-		std::istringstream inputStream(line);
+		std::swap(touchedSlots, drainedSlots);
 
-		if (inputStream >> existingID >> existingData)
+		// Cleared under touchMutex, so an access after this lands in
+		// the next drain
+		for (size_t slot : drainedSlots)
 		{
-			if (existingID == ID)
-			{
-				input.close();
-				return existingData;
-			}
+			touched[slot].store(0, std::memory_order_relaxed);
 		}
 	}
 
-	input.close();
-	return std::nullopt;
+	for (size_t slot : drainedSlots)
+	{
+		replacementPolicy->touch(slot);
+	}
+
+	drainedSlots.clear();
 }
 
-void PhysicalMemory::updateData(unsigned long long ID, size_t key)
+void PhysicalMemory::touch(size_t index)
 {
-	std::unique_lock<std::recursive_mutex> updateLock(updateMutex);
-
-	std::optional<std::string> data = readBackingStore(ID);
-	std::vector<std::string> parsed;
-
-	if (!data)
+	if (touched[index].load(std::memory_order_relaxed) || touched[index].exchange(1, std::memory_order_relaxed))
 	{
-		std::cerr << "\n                                              ERROR: Frame not in backing store\n";
-		throw std::runtime_error("Error: Frame not in backing store\n");
 		return;
 	}
-	else
-	{
-		parsed = parseData(*data);
-	}
 
-	unsigned long long index = 0;
-	for (index; index < parsed.size(); index++)
+	std::unique_lock<std::mutex> touchLock(touchMutex);
+
+	touchedSlots.push_back(index);
+}
+
+void PhysicalMemory::placeFrame(unsigned long long ID, size_t index, size_t count)
+{
+	if (frames[index])
 	{
-		std::ostringstream stream;
-		stream << std::hex << std::uppercase << std::setw(5) << std::setfill('0') << index;
-		std::string address = stream.str();
+		residentSlots.erase(frames[index]->getID());
 
-		if (frames[key])
+		// A huge victim only keeps its first slot
+		for (size_t i = 1; i < spans[index]; i++)
 		{
-			frames[key]->write(address, parsed[index]);
+			heads[index + i] = index + i;
+			releaseSlot(index + i);
 		}
 	}
 
-	for (index; index < frameSize; index++)
+	frames[index].emplace(ID, memory.data() + index * frameSize, frameSize * count);
+	residentSlots[ID] = index;
+	spans[index] = count;
+
+	for (size_t i = 0; i < count; i++)
 	{
-		std::ostringstream stream;
-		stream << std::hex << std::uppercase << std::setw(5) << std::setfill('0') << index;
-		std::string address = stream.str();
+		heads[index + i] = index;
+		claimSlot(index + i);
+	}
+
+	std::unique_lock<std::mutex> usageLock(usageMutex);
+	drainTouches();
+	pinned[index] = 0;
+	replacementPolicy->admit(index, ID);
+}
 
-		frames[key]->write(address, "00");
+void PhysicalMemory::updateData(unsigned long long ID, size_t key)
+{
+	std::unique_lock<std::recursive_mutex> updateLock(updateMutex);
+	std::unique_lock<std::recursive_mutex> backingStoreLock(backingStoreMutex);
+
+	if (!swap.read(ID, memory.data() + key * frameSize))
+	{
+		std::cerr << "\n                                              ERROR: Frame not in backing store\n";
+		throw std::runtime_error("Error: Frame not in backing store\n");
 	}
 }
 
 // ----- << Public Member Function Implementation >> ----- //
-PhysicalMemory::PhysicalMemory(size_t frameSize, size_t overallSize)
-	: frameSize(frameSize), overallSize(overallSize), dataPlaceholder("")
+PhysicalMemory::PhysicalMemory(size_t frameSize, size_t overallSize, std::string replacementPolicy, std::string backingStoreMode, std::string backingStorePath, size_t compressedPoolSize)
+	: frameSize(frameSize), overallSize(overallSize),
+	backingStore(frameSize, backingStorePath, backingStoreMode),
+	swap(frameSize, compressedPoolSize, backingStore)
 {
 	numFrames = overallSize / frameSize;
 	frames = std::vector<std::optional<Frame>>(numFrames, std::nullopt);
+	heads = std::vector<size_t>(numFrames);
+	spans = std::vector<size_t>(numFrames, 0);
+	memory = std::vector<uint8_t>(numFrames * frameSize, 0);
+	residentSlots.reserve(numFrames);
 
-	for (size_t i = 0; i < frameSize; i++)
+	for (size_t i = 0; i < numFrames; i++)
 	{
-		dataPlaceholder += "00";
+		heads[i] = i;
+	}
+
+	this->replacementPolicy = ReplacementPolicy::create(replacementPolicy, numFrames);
+	touched = std::vector<std::atomic<uint8_t>>(numFrames);
+	touchedSlots.reserve(numFrames);
+	drainedSlots.reserve(numFrames);
+	pinned = std::vector<uint8_t>(numFrames, 0);
+	pinHand = 0;
+
+	// Every slot starts free; bits past numFrames stay clear
+	freeFrames = numFrames;
+	freeBitmap = std::vector<uint64_t>((numFrames + 63) / 64, 0);
+	freeSummary = std::vector<uint64_t>((freeBitmap.size() + 63) / 64, 0);
+
+	for (size_t i = 0; i < freeBitmap.size(); i++)
+	{
+		size_t remaining = numFrames - i * 64;
+
+		freeBitmap[i] = remaining >= 64 ? ~uint64_t(0) : (uint64_t(1) << remaining) - 1;
+		freeSummary[i / 64] |= uint64_t(1) << (i % 64);
 	}
 }
 
@@ -171,29 +217,102 @@ size_t PhysicalMemory::convertHexToDecimal(std::string hex)
 	return result;
 }
 
+bool PhysicalMemory::copyFrame(unsigned long long ID, uint8_t* buffer)
+{
+	std::optional<size_t> index = find(ID);
+
+	if (!index)
+	{
+		return false;
+	}
+
+	std::memcpy(buffer, memory.data() + *index * frameSize, frameSize * spans[*index]);
+	return true;
+}
+
+void PhysicalMemory::discardBackingStore(unsigned long long firstID, size_t count)
+{
+	std::unique_lock<std::recursive_mutex> backingStoreLock(backingStoreMutex);
+
+	swap.discard(firstID, count);
+}
+
+size_t PhysicalMemory::exportBackingStore(const std::string& path)
+{
+	return swap.exportText(path);
+}
+
+double PhysicalMemory::getCompressionRatio()
+{
+	return swap.getCompressionRatio();
+}
+
+size_t PhysicalMemory::getSwapPoolHits() const
+{
+	return swap.getPoolHits();
+}
+
 std::optional<size_t> PhysicalMemory::find(unsigned long long ID)
 {
-	for (size_t i = 0; i < numFrames; i++)
+	auto slot = residentSlots.find(ID);
+
+	if (slot != residentSlots.end())
 	{
-		if (frames[i])
+		return slot->second;
+	}
+
+	return std::nullopt;
+}
+
+std::optional<size_t> PhysicalMemory::findFreeFrame()
+{
+	std::unique_lock<std::mutex> freeFrameLock(freeFrameMutex);
+
+	if (freeFrames == 0)
+	{
+		return std::nullopt;
+	}
+
+	// Summary word -> bitmap word -> slot, lowest free slot first
+	for (size_t i = 0; i < freeSummary.size(); i++)
+	{
+		if (freeSummary[i])
 		{
-			if (frames[i]->getID() == ID)
-			{
-				return i;
-			}
+			size_t word = i * 64 + std::countr_zero(freeSummary[i]);
+
+			return word * 64 + std::countr_zero(freeBitmap[word]);
 		}
 	}
 
 	return std::nullopt;
 }
 
-std::optional<size_t> PhysicalMemory::findFreeFrame()
+std::optional<size_t> PhysicalMemory::findFreeRun(size_t count)
 {
-	for (size_t i = 0; i < numFrames; i++)
+	if (count == 1)
+	{
+		return findFreeFrame();
+	}
+
+	std::unique_lock<std::mutex> freeFrameLock(freeFrameMutex);
+
+	if (freeFrames < count)
 	{
-		if (!frames[i])
+		return std::nullopt;
+	}
+
+	for (size_t index = 0; index + count <= numFrames; index += count)
+	{
+		// Skip bitmap words without a free slot
+		if (count < 64 && index % 64 == 0 && !(freeSummary[index / 4096] & (uint64_t(1) << (index / 64 % 64))))
+		{
+			index += 64 - count;
+			continue;
+		}
+
+		if (isRunFree(index, count))
 		{
-			return i;
+			return index;
 		}
 	}
 
@@ -202,41 +321,103 @@ std::optional<size_t> PhysicalMemory::findFreeFrame()
 
 std::optional<unsigned long long> PhysicalMemory::getFrameID(size_t index)
 {
-	if (frames[index])
+	if (frames[heads[index]])
 	{
-		return frames[index]->getID();
+		return frames[heads[index]]->getID();
 	}
 
 	return std::nullopt;
 }
 
+size_t PhysicalMemory::getSpan(size_t index) const
+{
+	return frames[index] ? spans[index] : 0;
+}
+
 size_t PhysicalMemory::getVictimKey()
 {
-	if (usageList.empty())
+	std::unique_lock<std::mutex> usageLock(usageMutex);
+
+	drainTouches();
+
+	std::optional<size_t> victimKey = replacementPolicy->evict();
+
+	if (victimKey)
 	{
-		//throw std::runtime_error("\nERROR: No available frames to evict\n");
+		return *victimKey;
 	}
 
-	size_t victimKey = usageList.back();
-	usageList.pop_back();
+	// Every resident frame is pinned, take them in turn
+	for (size_t step = 0; step < numFrames; step++)
+	{
+		size_t candidate = pinHand;
+		pinHand = (pinHand + 1) % numFrames;
+
+		if (pinned[candidate] && frames[candidate])
+		{
+			return candidate;
+		}
+	}
 
-	return victimKey;
+	throw std::runtime_error("\nERROR: No available frames to evict\n");
 }
 
-std::optional<size_t> PhysicalMemory::locateFrame(unsigned long long requestedFrame)
+bool PhysicalMemory::isPinned(size_t index)
 {
-	for (size_t i = 0; i < numFrames; i++)
+	std::unique_lock<std::mutex> usageLock(usageMutex);
+
+	return pinned[index];
+}
+
+void PhysicalMemory::pin(size_t index)
+{
+	std::unique_lock<std::mutex> usageLock(usageMutex);
+
+	if (frames[index] && !pinned[index])
 	{
-		if (frames[i])
-		{
-			if (frames[i]->getID() == requestedFrame)
-			{
-				return i;
-			}
-		}
+		replacementPolicy->remove(index);
+		pinned[index] = 1;
 	}
+}
 
-	return std::nullopt;
+void PhysicalMemory::restoreVictim(size_t index)
+{
+	std::unique_lock<std::mutex> usageLock(usageMutex);
+
+	if (frames[index])
+	{
+		replacementPolicy->admit(index, frames[index]->getID());
+	}
+}
+
+void PhysicalMemory::unpin(size_t index)
+{
+	std::unique_lock<std::mutex> usageLock(usageMutex);
+
+	if (frames[index] && pinned[index])
+	{
+		pinned[index] = 0;
+		replacementPolicy->admit(index, frames[index]->getID());
+	}
+}
+
+void PhysicalMemory::loadFrame(unsigned long long ID, size_t index, size_t count, const uint8_t* data)
+{
+	std::unique_lock<std::recursive_mutex> updateLock(updateMutex);
+
+	placeFrame(ID, index, count);
+
+	std::memcpy(memory.data() + index * frameSize, data, frameSize * count);
+}
+
+std::unique_lock<std::recursive_mutex> PhysicalMemory::lockBackingStore()
+{
+	return std::unique_lock<std::recursive_mutex>(backingStoreMutex);
+}
+
+std::optional<size_t> PhysicalMemory::locateFrame(unsigned long long requestedFrame)
+{
+	return find(requestedFrame);
 }
 
 void PhysicalMemory::overwriteBackingStore(size_t victimKey)
@@ -253,47 +434,41 @@ void PhysicalMemory::overwriteBackingStore(size_t victimKey)
 		throw std::runtime_error("\nERROR: Overwriting invalid physical memory index\n");
 	}
 	
-	std::optional<std::string> frameData = compileFrameData(victimID);
-
-	if (frameData)
+	for (size_t i = 0; i < spans[victimKey]; i++)
 	{
-		writeBackingStore(victimID, *frameData);
-	}
-	else
-	{
-		std::cerr << "\nERROR: Trying to access frame not in memory for location " << victimKey << "\n";
+		swap.write(victimID + i, frames[victimKey]->data() + i * frameSize);
 	}
 }
 
-std::optional< std::string> PhysicalMemory::read(std::string address)
+bool PhysicalMemory::readBytes(size_t address, std::span<uint8_t> buffer)
 {
-	std::unique_lock<std::mutex> readLock(operationMutex);
-
-	std::pair<size_t, size_t> translatedAddress = translateAddress(address);
-	size_t index = translatedAddress.first;
-	size_t offset = translatedAddress.second;
+	size_t index = address / frameSize;
 
-	if (index >= numFrames)
+	if (index >= numFrames || address + buffer.size() > memory.size())
 	{
-		return std::nullopt;
+		return false;
 	}
 
-	if (frames[index])
-	{
-		usageList.remove(index);
-		usageList.push_front(index);
+	size_t head = heads[index];
 
-		return frames[index]->read(convertDecToHex(offset));
+	// The slot is inside the frame that starts at head, so the bytes
+	// are read from the slab instead of through the frame view
+	if (!frames[head] || address + buffer.size() > (head + spans[head]) * frameSize)
+	{
+		return false;
 	}
 
-	return std::nullopt;
+	std::memcpy(buffer.data(), memory.data() + address, buffer.size());
+	touch(head);
+
+	return true;
 }
 
 size_t PhysicalMemory::remove(std::vector<unsigned long long> rmVector)
 {
 	std::unique_lock<std::mutex> frameLock(frameMutex);
 
-	size_t removedFrames = 0;
+	size_t removedSlots = 0;
 	std::optional<size_t> victimFrame;
 	for (unsigned long long ID : rmVector)
 	{
@@ -301,21 +476,62 @@ size_t PhysicalMemory::remove(std::vector<unsigned long long> rmVector)
 
 		if (victimFrame)
 		{
-			overwriteBackingStore(*victimFrame);
-
 			frames[*victimFrame] = std::nullopt;
-			removedFrames++;
+			residentSlots.erase(ID);
+
+			for (size_t i = 0; i < spans[*victimFrame]; i++)
+			{
+				heads[*victimFrame + i] = *victimFrame + i;
+				releaseSlot(*victimFrame + i);
+			}
+
+			removedSlots += spans[*victimFrame];
+			spans[*victimFrame] = 0;
+
+			std::unique_lock<std::mutex> usageLock(usageMutex);
+			drainTouches();
+			pinned[*victimFrame] = 0;
+			replacementPolicy->remove(*victimFrame);
 		}
 	}
 
-	return removedFrames;
+	return removedSlots;
 }
 
-std::pair<size_t, size_t> PhysicalMemory::translateAddress(std::string address)
+bool PhysicalMemory::renameFrame(unsigned long long ID, unsigned long long newID)
 {
-	size_t base = convertHexToDecimal(address);
-	size_t pageNumber = base / frameSize;
-	size_t offset = base % frameSize;
+	std::unique_lock<std::recursive_mutex> updateLock(updateMutex);
+
+	std::optional<size_t> index = find(ID);
+
+	if (!index)
+	{
+		return false;
+	}
+
+	frames[*index].emplace(newID, memory.data() + *index * frameSize, frameSize * spans[*index]);
+	residentSlots.erase(ID);
+	residentSlots[newID] = *index;
+
+	return true;
+}
+
+void PhysicalMemory::readBackingStore(unsigned long long firstID, size_t count, uint8_t* buffer)
+{
+	std::unique_lock<std::recursive_mutex> backingStoreLock(backingStoreMutex);
+
+	swap.readRange(firstID, count, buffer);
+}
+
+void PhysicalMemory::reserveBackingStore(unsigned long long frameCount)
+{
+	backingStore.reserve(frameCount);
+}
+
+std::pair<size_t, size_t> PhysicalMemory::translateAddress(size_t address)
+{
+	size_t pageNumber = address / frameSize;
+	size_t offset = address % frameSize;
 
 	//std::cout << "PageNumber: " << pageNumber << "\nOffset: " << offset << "\n";
 
@@ -330,107 +546,52 @@ std::pair<size_t, size_t> PhysicalMemory::translateAddress(std::string address)
 void PhysicalMemory::updateFrame(unsigned long long ID, size_t index)
 {
 	std::unique_lock<std::recursive_mutex> updateLock(updateMutex);
-	// Update physical memory
-	frames[index].emplace(ID, frameSize);
+
+	placeFrame(ID, index, 1);
 
 	// Fill the frame with the data from the backing store
 	updateData(ID, index);
-
-	usageList.push_front(index);
 }
 
-bool PhysicalMemory::write(std::string address, std::string data)
+void PhysicalMemory::updateZeroFrame(unsigned long long ID, size_t index, size_t count)
 {
-	std::unique_lock<std::mutex> writeLock(operationMutex);
+	std::unique_lock<std::recursive_mutex> updateLock(updateMutex);
+
+	placeFrame(ID, index, count);
 
-	std::pair<size_t, size_t> translatedAddress = translateAddress(address);
-	size_t index = translatedAddress.first;
-	size_t offset = translatedAddress.second;
+	std::memset(memory.data() + index * frameSize, 0, frameSize * count);
+}
 
-	if (data.size() > 2)
+bool PhysicalMemory::writeBytes(size_t address, std::span<const uint8_t> data)
+{
+	size_t index = address / frameSize;
+
+	if (index >= numFrames || address + data.size() > memory.size())
 	{
-		std::cout << "\nERROR: Data is larger than 1 byte @PhysicalMemory::write\n\n";
 		return false;
 	}
 
-	if (index >= numFrames)
+	size_t head = heads[index];
+
+	if (!frames[head] || address + data.size() > (head + spans[head]) * frameSize)
 	{
 		return false;
 	}
 
-	if (frames[index])
-	{
-		frames[index]->write(convertDecToHex(offset), data);
-
-		usageList.remove(index);
-		usageList.push_front(index);
-		return true;
-	}
+	std::memcpy(memory.data() + address, data.data(), data.size());
+	touch(head);
 
-	return false;
+	return true;
 }
 
-void PhysicalMemory::writeBackingStore(unsigned long long ID, std::string data)
+void PhysicalMemory::writeBackingStore(unsigned long long firstID, size_t count, const uint8_t* data)
 {
 	std::unique_lock<std::recursive_mutex> writeBackingStoreLock(backingStoreMutex);
 
-	std::ifstream input("backing-store.txt");
-	std::ofstream temp("backing-store.tmp", std::ios::trunc);
-
-	if (!temp)
-	{
-		throw std::runtime_error("Error: cannot open temporary file for write");
-	}
-
-	bool inserted = false;
-	bool updated = false;
-
-	std::string line;
-
-	if (input)
-	{
-		while (std::getline(input, line))
-		{
-			std::istringstream stream(line);
-			unsigned long long existingID;
-			std::string existingData;
-
-			if (stream >> existingID >> existingData)
-			{
-				if (existingID == ID)
-				{
-					temp << ID << " " << data << "\n";
-					updated = true;
-				}
-				else if (!updated && !inserted && existingID > ID)
-				{
-					temp << ID << " " << data << "\n";
-					temp << line << "\n";
-					inserted = true;
-				}
-				else
-				{
-					temp << line << "\n";
-				}
-			}
-			else
-			{
-				temp << line << "\n";
-			}
-		}
-	}
-
-	if (!updated && !inserted)
+	for (size_t i = 0; i < count; i++)
 	{
-		temp << ID << " " << data << "\n";
+		swap.write(firstID + i, data + i * frameSize);
 	}
-
-	input.close();
-	temp.flush();
-	temp.close();
-
-	std::remove("backing-store.txt");
-	std::rename("backing-store.tmp", "backing-store.txt");
 }
 
 void PhysicalMemory::print(size_t location)
@@ -457,6 +618,11 @@ void PhysicalMemory::printFrames()
 			str = "Location [" + std::to_string(i) + "]";
 			std::cout << std::left << std::setw(20) << str << "stores frame " << frames[i]->getID() << "\n";
 		}
+		else if (heads[i] != i)
+		{
+			str = "Location [" + std::to_string(i) + "]";
+			std::cout << std::left << std::setw(20) << str << "stores part of frame " << frames[heads[i]]->getID() << "\n";
+		}
 		else
 		{
 			str = "Location [" + std::to_string(i) + "]";
@@ -1,12 +1,18 @@
 #pragma once
 
 // ----- << External Libraray >> ----- //
+#include "BackingStore.hpp"
+#include "CompressedSwap.hpp"
 #include "Frame.hpp"
+#include "ReplacementPolicy.hpp"
+#include <atomic>
 #include <condition_variable>
-#include <list>
+#include <cstdint>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -20,61 +26,138 @@ class PhysicalMemory
 private:
 	// Primitive Data Members
 	size_t frameSize;
+	size_t freeFrames;
 	size_t numFrames;
 	size_t overallSize;
 
 	// User-defined Data Members
 	std::mutex frameMutex;
+	std::mutex freeFrameMutex;
 	std::mutex overwriteBackingStoreMutex;
 	std::mutex printMutex;
+	std::mutex touchMutex;
+	std::mutex usageMutex;
 	std::mutex readBackingStoreMutex;
 	std::mutex writeBackingStoreMutex;
-	std::mutex operationMutex;
 
 	std::recursive_mutex backingStoreMutex;
 	std::recursive_mutex updateMutex;
 
-	std::string dataPlaceholder;
+	BackingStore backingStore;
+
+	CompressedSwap swap;
+			// Every page in and page out goes through the 
+			// compressed pool in front of backingStore
+
 
-	std::list<unsigned long long> usageList;
-	
 	std::vector<std::optional<Frame>> frames;
+			// Views into memory, held by the first slot of each
+			// frame
+
+	std::vector<size_t> heads;
+			// The first slot of the frame that holds each slot
+	std::vector<size_t> spans;
+			// Slots covered by the frame that starts at each slot,
+			// more than one for a huge frame
+
+	std::vector<uint8_t> memory;
+			// Contiguous storage for every frame (overallSize bytes)
+
+	std::unordered_map<unsigned long long, size_t> residentSlots;
+			// Frame ID, Index of the frame in physical memory
+
+	std::vector<uint64_t> freeBitmap;
+			// One bit per slot, set when the slot holds no frame
+
+	std::vector<uint64_t> freeSummary;
+			// One bit per freeBitmap word, set when the word has a free slot
+
+	std::unique_ptr<ReplacementPolicy> replacementPolicy;
+			// Decides the victim slot, guarded by usageMutex
+
+	std::vector<uint8_t> pinned;
+			// Set at the first slot of a frame that is kept out of
+			// the replacement policy, guarded by usageMutex
+	size_t pinHand;
+			// Where the search for a pinned victim resumes
+
+	std::vector<std::atomic<uint8_t>> touched;
+			// Set by the first access of a slot since the replacement
+			// policy last heard of it, read without a lock
+	std::vector<size_t> touchedSlots;
+			// Slots whose touched bit is set, in order of that first
+			// access. Guarded by touchMutex
+	std::vector<size_t> drainedSlots;
+			// touchedSlots being reported, guarded by usageMutex
 
 private:
 	/**
-	 * @brief	Compiles the entire frame data into a single
-	 *			string of hex digits
-	 *
-	 * @param	ID --
-	 *			The unique ID that identifies a frame
-	 *
-	 * @return	A string of hex digits representing the data of the
-	 *			frame starting with address location 0x00000
+	 * @brief	Checks if an aligned run of slots is free
+	 * 
+	 *			WARNING: Caller must hold freeFrameMutex
+	 * 
+	 * @param	index --
+	 *			The first slot of the run
+	 * 
+	 * @param	count --
+	 *			The number of slots in the run, a power of 2
+	 * 
+	 * @return	true if every slot of the run is free. Otherwise,
+	 *			false.
 	 */
-	std::optional<std::string>
-		compileFrameData(unsigned long long ID);
+	bool isRunFree(size_t index, size_t count) const;
 
 	/**
-	 * @brief	Parse raw data representation from backing store 
-	 *			into 2 hexadecimal character chunks
+	 * @brief	Mark a slot as holding a frame in the free-frame
+	 *			bitmap
 	 * 
-	 * @param	raw --
-	 *			The raw hexadecimal character string from the 
-	 *			backing store
+	 * @param	index --
+	 *			The index of the slot in physical memory
+	 */
+	void claimSlot(size_t index);
+
+	/**
+	 * @brief	Return a slot to the free-frame bitmap
+	 * 
+	 * @param	index --
+	 *			The index of the slot in physical memory
+	 */
+	void releaseSlot(size_t index);
+
+	/**
+	 * @brief	Reports each slot in touchedSlots to the replacement
+	 *			policy once, before the policy chooses a victim or a
+	 *			slot changes frames
 	 * 
-	 * @return	A vector containing the parsed data
+	 *			WARNING: Caller must hold usageMutex
 	 */
-	std::vector<std::string> parseData(std::string raw) const;
+	void drainTouches();
 
 	/**
-	 * @brief	Read a frame from the backing store
-	 *
+	 * @brief	Record an access of a slot for the replacement policy.
+	 *			Only the first access since the last drain takes a
+	 *			lock
+	 * 
+	 * @param	index --
+	 *			The index of the slot in physical memory
+	 */
+	void touch(size_t index);
+
+	/**
+	 * @brief	Puts a frame view in a run of slots and hands the
+	 *			first slot to the replacement policy, without 
+	 *			touching its data
+	 * 
 	 * @param	ID --
 	 *			The unique ID that identifies a frame
+	 * 
+	 * @param	index --
+	 *			The index of the first slot in physical memory
+	 * 
+	 * @param	count --
+	 *			The number of slots the frame covers
 	 */
-	std::optional<std::string> readBackingStore(
-		unsigned long long ID
-	);
+	void placeFrame(unsigned long long ID, size_t index, size_t count);
 
 	/**
 	 * @brief	Reads the backing store and overwrites the contents
@@ -91,8 +174,30 @@ private:
 public:
 	/**
 	 * @brief	Class constructor
+	 * 
+	 * @param	replacementPolicy --
+	 *			Name of the page replacement policy, one of LRU, 
+	 *			CLOCK, FIFO, LFU, ARC, or 2Q
+	 * 
+	 * @param	backingStoreMode --
+	 *			"FILE" or "MMAP", see BackingStore
+	 * 
+	 * @param	backingStorePath --
+	 *			File that backs the swapped out frames. It is 
+	 *			truncated when the physical memory is created
+	 * 
+	 * @param	compressedPoolSize --
+	 *			Most compressed bytes the swap pool holds, see 
+	 *			CompressedSwap
 	 */
-	PhysicalMemory(size_t frameSize, size_t overallSize);
+	PhysicalMemory(
+		size_t frameSize, 
+		size_t overallSize, 
+		std::string replacementPolicy,
+		std::string backingStoreMode,
+		std::string backingStorePath,
+		size_t compressedPoolSize
+	);
 
 	/**
 	 * @brief	Class destructor
@@ -122,6 +227,60 @@ public:
 	 */
 	size_t convertHexToDecimal(std::string hex);
 
+	/**
+	 * @brief	Copies the data of a resident frame
+	 * 
+	 * @param	ID --
+	 *			The unique ID of the frame being copied
+	 * 
+	 * @param	buffer --
+	 *			Destination of frameSize bytes for every slot the
+	 *			frame covers
+	 * 
+	 * @return	true if the frame is resident and was copied.
+	 *			Otherwise, false.
+	 */
+	bool copyFrame(unsigned long long ID, uint8_t* buffer);
+
+	/**
+	 * @brief	Drops consecutive frames from the compressed swap
+	 *			pool, for frames that no page uses anymore
+	 * 
+	 * @param	firstID --
+	 *			The unique ID of the first frame
+	 * 
+	 * @param	count --
+	 *			The number of frames dropped
+	 */
+	void discardBackingStore(unsigned long long firstID, size_t count);
+
+	/**
+	 * @brief	Writes the backing store as a text file of
+	 *			"ID HEXDATA" lines for debugging
+	 * 
+	 * @param	path --
+	 *			The text file that is written
+	 * 
+	 * @return	The number of frames exported
+	 */
+	size_t exportBackingStore(const std::string& path);
+
+	/**
+	 * @brief	Get the compression ratio of the swap pool
+	 * 
+	 * @return	Uncompressed over compressed bytes of the pooled
+	 *			frames. 0 if the pool is empty
+	 */
+	double getCompressionRatio();
+
+	/**
+	 * @brief	Get the number of frames paged in from the swap
+	 *			pool instead of the backing store
+	 * 
+	 * @return	The number of swap pool hits
+	 */
+	size_t getSwapPoolHits() const;
+
 	/**
 	 * @brief	Checks if a frame is in the Physical Memory.
 	 *
@@ -141,11 +300,24 @@ public:
 	 */
 	std::optional<size_t> findFreeFrame();
 
+	/**
+	 * @brief	Find a run of free slots that starts at a multiple
+	 *			of its length, for a huge frame
+	 * 
+	 * @param	count --
+	 *			The number of slots, a power of 2
+	 * 
+	 * @return	The first slot of the run. Otherwise, a 
+	 *			std::nullopt
+	 */
+	std::optional<size_t> findFreeRun(size_t count);
+
 	/**
 	 * @brief	Get the ID of a frame 
 	 * 
 	 * @param	index --
-	 *			Location of the desired frame in the physical memory
+	 *			Location of the desired frame in the physical 
+	 *			memory, any slot of a huge frame
 	 * 
 	 * @return	null if index has no frame loaded. 
 	 *			The ID if found.
@@ -153,12 +325,97 @@ public:
 	std::optional<unsigned long long> getFrameID(size_t index);
 
 	/**
-	 * @brief	Get the key that is going to be evicted
+	 * @brief	Get the number of slots a frame covers
+	 * 
+	 * @param	index --
+	 *			The first slot of the frame
+	 * 
+	 * @return	The number of slots. 0 if no frame starts there
+	 */
+	size_t getSpan(size_t index) const;
+
+	/**
+	 * @brief	Get the key that is going to be evicted, as chosen
+	 *			by the replacement policy
+	 * 
+	 *			Pinned frames are not in the policy. Only when every
+	 *			resident frame is pinned is a pinned one chosen, and
+	 *			it stays marked pinned until its slot is reused or
+	 *			freed
 	 * 
 	 * @return	The victim key
 	 */
 	size_t getVictimKey();
 
+	/**
+	 * @brief	Checks if a frame is pinned
+	 * 
+	 * @param	index --
+	 *			The first slot of the frame
+	 * 
+	 * @return	true if the frame is pinned. Otherwise, false.
+	 */
+	bool isPinned(size_t index);
+
+	/**
+	 * @brief	Takes a resident frame out of the replacement 
+	 *			policy, so it is only evicted when every frame is
+	 *			pinned
+	 * 
+	 * @param	index --
+	 *			The first slot of the frame
+	 */
+	void pin(size_t index);
+
+	/**
+	 * @brief	Hands a victim from getVictimKey back to the 
+	 *			replacement policy when it is not evicted after all
+	 * 
+	 * @param	index --
+	 *			The victim key
+	 */
+	void restoreVictim(size_t index);
+
+	/**
+	 * @brief	Hands a pinned frame back to the replacement policy
+	 * 
+	 * @param	index --
+	 *			The first slot of the frame
+	 */
+	void unpin(size_t index);
+
+	/**
+	 * @brief	Puts a frame into physical memory with the given
+	 *			data, as read ahead of time from the backing store
+	 *
+	 * @param	ID --
+	 *			The unique ID that identifies the frame
+	 *
+	 * @param	index --
+	 *			The index of the frame, in physical memory, that is
+	 *			treated as the victim frame
+	 * 
+	 * @param	count --
+	 *			The number of slots the frame covers
+	 * 
+	 * @param	data --
+	 *			The count * frameSize bytes of the frame
+	 */
+	void loadFrame(
+		unsigned long long ID,
+		size_t index,
+		size_t count,
+		const uint8_t* data
+	);
+
+	/**
+	 * @brief	Locks the backing store so that no frame is paged in
+	 *			or written back until the lock is released
+	 * 
+	 * @return	The held lock
+	 */
+	std::unique_lock<std::recursive_mutex> lockBackingStore();
+
 	/**
 	 * @brief	Locates a frame in the physical memory
 	 * 
@@ -176,6 +433,9 @@ public:
 	 * @brief	Overwrite an existing copy of a frame in the backing
 	 *			store with the current data in phyical memory
 	 * 
+	 *			A huge frame is written to the consecutive IDs that
+	 *			start at its own
+	 * 
 	 * @param	victimKey --
 	 *			The location of the frame, in physical memory, that
 	 *			is going to be loaded into the backing store
@@ -183,35 +443,89 @@ public:
 	void overwriteBackingStore(size_t victimKey);
 
 	/**
-	 * @brief	Read from a memory location in the Physical Memory
+	 * @brief	Copies contiguous bytes out of the Physical Memory
+	 *			and touches their frame once
+	 * 
+	 *			Not locked, the MMU keeps the slot from being 
+	 *			reused during the access
 	 *
 	 * @param	address --
-	 *			The address where the data is to be read from
+	 *			The physical address of the first byte
 	 * 
-	 * @return	The data that was read
+	 * @param	buffer --
+	 *			Destination of the bytes, which must all be in the
+	 *			frame that holds the first one
+	 * 
+	 * @return	true if the frame is resident and the bytes were
+	 *			read. Otherwise, false.
 	 */
-	std::optional<std::string> read(std::string address);
+	bool readBytes(size_t address, std::span<uint8_t> buffer);
 
 	/**
-	 * @brief	Removes the frames with the corresponding IDs
+	 * @brief	Removes the frames with the corresponding IDs,
+	 *			discarding their data
 	 * 
 	 * @param	rmVector --
 	 *			A vector containing the IDs of the frams that
 	 *			need to be removed
+	 * 
+	 * @return	The number of slots freed
 	 */
 	size_t remove(std::vector<unsigned long long> rmVector);
 
+	/**
+	 * @brief	Gives a resident frame a new ID without touching its
+	 *			slot or its data
+	 * 
+	 * @param	ID --
+	 *			The current ID of the frame
+	 * 
+	 * @param	newID --
+	 *			The ID the frame is found by afterwards
+	 * 
+	 * @return	true if the frame is resident and was renamed.
+	 *			Otherwise, false.
+	 */
+	bool renameFrame(unsigned long long ID, unsigned long long newID);
+
+	/**
+	 * @brief	Reads consecutive frames from the backing store in
+	 *			one read
+	 * 
+	 * @param	firstID --
+	 *			The unique ID of the first frame
+	 * 
+	 * @param	count --
+	 *			The number of frames read
+	 * 
+	 * @param	buffer --
+	 *			Destination of count * frameSize bytes
+	 */
+	void readBackingStore(
+		unsigned long long firstID, 
+		size_t count, 
+		uint8_t* buffer
+	);
+
+	/**
+	 * @brief	Makes room in the backing store for frame IDs below
+	 *			frameCount
+	 * 
+	 * @param	frameCount --
+	 *			Number of frame IDs that have been created
+	 */
+	void reserveBackingStore(unsigned long long frameCount);
+
 	/**
 	 * @brief	Tranlsates raw memory address to a page number and
 				page offset pair
 	 *
 	 * @param	address --
-	 *			The raw address is being accessed
+	 *			The raw physical address is being accessed
 	 *
-	 * @return	A string value pair containing the page number
-	 *			and the offset
+	 * @return	A pair containing the page number and the offset
 	 */
-	std::pair<size_t, size_t> translateAddress(std::string address);
+	std::pair<size_t, size_t> translateAddress(size_t address);
 
 	/**
 	 * @brief	Sequence of instructions to update physical memory
@@ -231,29 +545,64 @@ public:
 	);
 
 	/**
-	 * @brief	Write to a memory location in the Physical Memory
+	 * @brief	Puts a frame that has never been written to the 
+	 *			backing store into physical memory, filled with
+	 *			zeros, without any backing store I/O
+	 *
+	 * @param	ID --
+	 *			The unique ID that identifies the frame
+	 *
+	 * @param	index --
+	 *			The index of the frame, in physical memory, that is
+	 *			treated as the victim frame
+	 * 
+	 * @param	count --
+	 *			The number of slots the frame covers
+	 */
+	void updateZeroFrame(
+		unsigned long long ID,
+		size_t index,
+		size_t count
+	);
+
+	/**
+	 * @brief	Copies contiguous bytes into the Physical Memory
+	 *			and touches their frame once
+	 * 
+	 *			Not locked, the MMU keeps the slot from being 
+	 *			reused during the access
 	 * 
 	 * @param	address --
-	 *			The address that is going to be written to
+	 *			The physical address of the first byte
 	 * 
 	 * @param	data --
-	 *			The data that is going to be written
+	 *			The bytes written, which must all fit in the frame
+	 *			that holds the first one
+	 * 
+	 * @return	true if the frame is resident and the bytes were
+	 *			written. Otherwise, false.
 	 */
-	bool write(std::string address, std::string data);
+	bool writeBytes(size_t address, std::span<const uint8_t> data);
 
 	/**
-	 * @brief	Write a frame to the backing store and remove
-	 *			it from physical memory
+	 * @brief	Write consecutive frames to their slots in the 
+	 *			backing store. Takes the backing store lock, so a 
+	 *			caller that already holds lockBackingStore may 
+	 *			call it
 	 *
-	 * @param	ID --
-	 *			The unique ID that identifies a frame
+	 * @param	firstID --
+	 *			The unique ID of the first frame
+	 * 
+	 * @param	count --
+	 *			The number of frames written
 	 *
 	 * @param	data --
-	 *			Data that a frame contains
+	 *			The count * frameSize bytes of the frames
 	 */
 	void writeBackingStore(
-		unsigned long long ID, 
-		std::string data
+		unsigned long long firstID, 
+		size_t count,
+		const uint8_t* data
 	);
 
 	/**
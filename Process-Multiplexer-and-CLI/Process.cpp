@@ -12,6 +12,14 @@ Process::Process(unsigned long long ID, size_t heapSize, std::vector<std::unique
 	}
 }
 
+Process::Process(unsigned long long ID, size_t heapSize, const Process& parent)
+	: logicalDataSection(parent.logicalDataSection),
+	processID(ID), dataSection(parent.dataSection), heap(heapSize),
+	textSection(parent.textSection.share())
+{
+
+}
+
 Process::Process(Process&& source) noexcept
 	: logicalDataSection(std::move(source.logicalDataSection)),
 	processID(source.processID), dataSection(std::move(source.dataSection)),
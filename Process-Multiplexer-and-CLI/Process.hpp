@@ -38,6 +38,25 @@ public:
 		std::vector<std::unique_ptr<Instruction>>& instructions
 	);
 
+	/**
+	 * @brief	Fork constructor. Shares the text section of the
+	 *			parent and copies its data sections
+	 * 
+	 * @param	ID --
+	 *			The ID of the forked process
+	 * 
+	 * @param	heapSize --
+	 *			The size of the heap of the forked process
+	 * 
+	 * @param	parent --
+	 *			The process that is forked
+	 */
+	Process(
+		unsigned long long ID,
+		size_t heapSize,
+		const Process& parent
+	);
+
 	/**
 	 * @brief	Copy constructor (deleted)
 	 */
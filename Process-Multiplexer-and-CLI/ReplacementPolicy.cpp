@@ -0,0 +1,52 @@
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy.hpp"
+#include "ReplacementPolicy_2Q.hpp"
+#include "ReplacementPolicy_ARC.hpp"
+#include "ReplacementPolicy_CLOCK.hpp"
+#include "ReplacementPolicy_FIFO.hpp"
+#include "ReplacementPolicy_LFU.hpp"
+#include "ReplacementPolicy_LRU.hpp"
+
+// ----- << Public Member Function Implementation >> ----- //
+ReplacementPolicy::ReplacementPolicy(size_t numFrames) : numFrames(numFrames)
+{
+
+}
+
+ReplacementPolicy::~ReplacementPolicy() = default;
+
+std::unique_ptr<ReplacementPolicy> ReplacementPolicy::create(const std::string& name, size_t numFrames)
+{
+	if (name == "LRU")
+	{
+		return std::make_unique<ReplacementPolicy_LRU>(numFrames);
+	}
+	else if (name == "CLOCK")
+	{
+		return std::make_unique<ReplacementPolicy_CLOCK>(numFrames);
+	}
+	else if (name == "FIFO")
+	{
+		return std::make_unique<ReplacementPolicy_FIFO>(numFrames);
+	}
+	else if (name == "LFU")
+	{
+		return std::make_unique<ReplacementPolicy_LFU>(numFrames);
+	}
+	else if (name == "ARC")
+	{
+		return std::make_unique<ReplacementPolicy_ARC>(numFrames);
+	}
+	else if (name == "2Q")
+	{
+		return std::make_unique<ReplacementPolicy_2Q>(numFrames);
+	}
+
+	throw std::invalid_argument("Unknown page replacement policy: " + name);
+}
+
+bool ReplacementPolicy::isPolicyName(const std::string& name)
+{
+	return name == "LRU" || name == "CLOCK" || name == "FIFO" ||
+		name == "LFU" || name == "ARC" || name == "2Q";
+}
\ No newline at end of file
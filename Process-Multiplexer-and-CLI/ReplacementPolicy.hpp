@@ -0,0 +1,106 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ----- << Class >> ----- //
+
+/**
+ * @brief	Base class for the page replacement policies that decide
+ *			which physical memory slot is evicted on a page fault
+ * 
+ *			Policies only track slot indices and frame IDs. They
+ *			never read or write frame data
+ */
+class ReplacementPolicy
+{
+protected:
+	// Primitive Data Members
+	size_t numFrames;
+
+public:
+	/**
+	 * @brief	Class constructor
+	 * 
+	 * @param	numFrames --
+	 *			The number of slots in physical memory
+	 */
+	ReplacementPolicy(size_t numFrames);
+
+	/**
+	 * @brief	Virtual class destructor
+	 */
+	virtual ~ReplacementPolicy();
+
+	/**
+	 * @brief	Creates the replacement policy with the given name
+	 * 
+	 * @param	name --
+	 *			One of LRU, CLOCK, FIFO, LFU, ARC, or 2Q
+	 * 
+	 * @param	numFrames --
+	 *			The number of slots in physical memory
+	 * 
+	 * @return	The replacement policy
+	 */
+	static std::unique_ptr<ReplacementPolicy> create(
+		const std::string& name,
+		size_t numFrames
+	);
+
+	/**
+	 * @brief	Checks if a name refers to a known replacement policy
+	 * 
+	 * @param	name --
+	 *			The name being checked
+	 * 
+	 * @return	true if create accepts the name. Otherwise, false.
+	 */
+	static bool isPolicyName(const std::string& name);
+
+	/**
+	 * @brief	A frame was loaded into a slot
+	 * 
+	 * @param	slot --
+	 *			The index of the slot in physical memory
+	 * 
+	 * @param	frameID --
+	 *			The unique ID of the frame that was loaded
+	 */
+	virtual void admit(size_t slot, unsigned long long frameID) = 0;
+
+	/**
+	 * @brief	Chooses a resident slot to evict and stops tracking it
+	 * 
+	 * @return	The victim slot. null if no slot is resident
+	 */
+	virtual std::optional<size_t> evict() = 0;
+
+	/**
+	 * @brief	Get the name of the policy
+	 * 
+	 * @return	The name accepted by create
+	 */
+	virtual std::string getName() const = 0;
+
+	/**
+	 * @brief	A slot was freed without being evicted
+	 * 
+	 * @param	slot --
+	 *			The index of the slot in physical memory
+	 */
+	virtual void remove(size_t slot) = 0;
+
+	/**
+	 * @brief	A resident slot was read or written
+	 * 
+	 * @param	slot --
+	 *			The index of the slot in physical memory
+	 */
+	virtual void touch(size_t slot) = 0;
+};
\ No newline at end of file
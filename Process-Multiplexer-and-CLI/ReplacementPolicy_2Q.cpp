@@ -0,0 +1,102 @@
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy_2Q.hpp"
+#include <algorithm>
+
+// ----- << Private Member Function Implementation >> ----- //
+void ReplacementPolicy_2Q::forget(size_t slot)
+{
+	if (location[slot] == A1IN)
+	{
+		a1in.erase(position[slot]);
+	}
+	else if (location[slot] == AM)
+	{
+		am.erase(position[slot]);
+	}
+
+	location[slot] = NONE;
+}
+
+// ----- << Public Member Function Implementation >> ----- //
+ReplacementPolicy_2Q::ReplacementPolicy_2Q(size_t numFrames)
+	: ReplacementPolicy(numFrames),
+	inCapacity(std::max<size_t>(1, numFrames / 4)), outCapacity(std::max<size_t>(1, numFrames / 2)),
+	location(numFrames, NONE), position(numFrames), slotFrame(numFrames, 0)
+{
+
+}
+
+void ReplacementPolicy_2Q::admit(size_t slot, unsigned long long frameID)
+{
+	forget(slot);
+	slotFrame[slot] = frameID;
+
+	auto ghost = ghosts.find(frameID);
+
+	if (ghost != ghosts.end())
+	{
+		a1out.erase(ghost->second);
+		ghosts.erase(ghost);
+
+		am.push_front(slot);
+		location[slot] = AM;
+		position[slot] = am.begin();
+	}
+	else
+	{
+		a1in.push_front(slot);
+		location[slot] = A1IN;
+		position[slot] = a1in.begin();
+	}
+}
+
+std::optional<size_t> ReplacementPolicy_2Q::evict()
+{
+	size_t victim;
+
+	if (!a1in.empty() && (a1in.size() > inCapacity || am.empty()))
+	{
+		victim = a1in.back();
+		a1in.pop_back();
+
+		a1out.push_front(slotFrame[victim]);
+		ghosts[slotFrame[victim]] = a1out.begin();
+
+		if (a1out.size() > outCapacity)
+		{
+			ghosts.erase(a1out.back());
+			a1out.pop_back();
+		}
+	}
+	else if (!am.empty())
+	{
+		victim = am.back();
+		am.pop_back();
+	}
+	else
+	{
+		return std::nullopt;
+	}
+
+	location[victim] = NONE;
+
+	return victim;
+}
+
+std::string ReplacementPolicy_2Q::getName() const
+{
+	return "2Q";
+}
+
+void ReplacementPolicy_2Q::remove(size_t slot)
+{
+	forget(slot);
+}
+
+void ReplacementPolicy_2Q::touch(size_t slot)
+{
+	if (location[slot] == AM)
+	{
+		am.splice(am.begin(), am, position[slot]);
+	}
+}
\ No newline at end of file
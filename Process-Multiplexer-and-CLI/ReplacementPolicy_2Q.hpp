@@ -0,0 +1,92 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy.hpp"
+#include <list>
+#include <unordered_map>
+
+// ----- << Class >> ----- //
+
+/**
+ * @brief	Derived class for 2Q replacement
+ * 
+ *			New frames enter the A1in FIFO. Frame IDs evicted from
+ *			A1in are remembered in the A1out ghost FIFO, and a
+ *			fault on a remembered ID loads the frame into the Am
+ *			LRU list instead. One-time scans never reach Am
+ */
+class ReplacementPolicy_2Q : public ReplacementPolicy
+{
+private:
+	enum LIST_LOCATION
+	{
+		NONE,
+		A1IN,
+		AM
+	};
+
+	// Primitive Data Members
+	size_t inCapacity;
+			// Slots A1in may hold before it is preferred for eviction
+
+	size_t outCapacity;
+			// Frame IDs A1out remembers
+
+	// User-defined Data Members
+	std::list<size_t> a1in;
+	std::list<size_t> am;
+			// Resident slots, front is most recent
+
+	std::list<unsigned long long> a1out;
+			// Ghost frame IDs, front is most recent
+
+	std::vector<LIST_LOCATION> location;
+	std::vector<std::list<size_t>::iterator> position;
+	std::vector<unsigned long long> slotFrame;
+			// Per-slot list membership and resident frame ID
+
+	std::unordered_map<unsigned long long, std::list<unsigned long long>::iterator> ghosts;
+			// Frame ID, Position in A1out
+
+	/**
+	 * @brief	Takes a slot out of A1in or Am without remembering it
+	 * 
+	 * @param	slot --
+	 *			The index of the slot in physical memory
+	 */
+	void forget(size_t slot);
+
+public:
+	/**
+	 * @brief	Class constructor
+	 */
+	ReplacementPolicy_2Q(size_t numFrames);
+
+	/**
+	 * @brief	Places the slot in Am if the frame ID is in A1out,
+	 *			otherwise in A1in
+	 */
+	void admit(size_t slot, unsigned long long frameID) override;
+
+	/**
+	 * @brief	Evicts the tail of A1in while it is over capacity,
+	 *			otherwise the tail of Am
+	 */
+	std::optional<size_t> evict() override;
+
+	/**
+	 * @brief	Get the name of the policy
+	 */
+	std::string getName() const override;
+
+	/**
+	 * @brief	Stops tracking the slot
+	 */
+	void remove(size_t slot) override;
+
+	/**
+	 * @brief	Moves the slot to the head of Am, slots in A1in 
+	 *			keep their place
+	 */
+	void touch(size_t slot) override;
+};
\ No newline at end of file
@@ -0,0 +1,138 @@
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy_ARC.hpp"
+#include <algorithm>
+
+// ----- << Private Member Function Implementation >> ----- //
+void ReplacementPolicy_ARC::forget(size_t slot)
+{
+	if (location[slot] == T1)
+	{
+		t1.erase(position[slot]);
+	}
+	else if (location[slot] == T2)
+	{
+		t2.erase(position[slot]);
+	}
+
+	location[slot] = NONE;
+}
+
+void ReplacementPolicy_ARC::trimGhosts()
+{
+	while (!b1.empty() && t1.size() + b1.size() > numFrames)
+	{
+		ghosts.erase(b1.back());
+		b1.pop_back();
+	}
+
+	while (!b2.empty() && t1.size() + t2.size() + b1.size() + b2.size() > numFrames * 2)
+	{
+		ghosts.erase(b2.back());
+		b2.pop_back();
+	}
+}
+
+// ----- << Public Member Function Implementation >> ----- //
+ReplacementPolicy_ARC::ReplacementPolicy_ARC(size_t numFrames)
+	: ReplacementPolicy(numFrames), target(0),
+	location(numFrames, NONE), position(numFrames), slotFrame(numFrames, 0)
+{
+
+}
+
+void ReplacementPolicy_ARC::admit(size_t slot, unsigned long long frameID)
+{
+	forget(slot);
+	slotFrame[slot] = frameID;
+
+	auto ghost = ghosts.find(frameID);
+
+	if (ghost != ghosts.end() && ghost->second.first == B1)
+	{
+		// Recency list was too small
+		size_t delta = std::max<size_t>(1, b2.size() / b1.size());
+		target = std::min(numFrames, target + delta);
+
+		b1.erase(ghost->second.second);
+		ghosts.erase(ghost);
+
+		t2.push_front(slot);
+		location[slot] = T2;
+		position[slot] = t2.begin();
+	}
+	else if (ghost != ghosts.end() && ghost->second.first == B2)
+	{
+		// Frequency list was too small
+		size_t delta = std::max<size_t>(1, b1.size() / b2.size());
+		target -= std::min(target, delta);
+
+		b2.erase(ghost->second.second);
+		ghosts.erase(ghost);
+
+		t2.push_front(slot);
+		location[slot] = T2;
+		position[slot] = t2.begin();
+	}
+	else
+	{
+		t1.push_front(slot);
+		location[slot] = T1;
+		position[slot] = t1.begin();
+	}
+
+	trimGhosts();
+}
+
+std::optional<size_t> ReplacementPolicy_ARC::evict()
+{
+	size_t victim;
+
+	if (!t1.empty() && (t1.size() > target || t2.empty()))
+	{
+		victim = t1.back();
+		t1.pop_back();
+
+		b1.push_front(slotFrame[victim]);
+		ghosts[slotFrame[victim]] = { B1, b1.begin() };
+	}
+	else if (!t2.empty())
+	{
+		victim = t2.back();
+		t2.pop_back();
+
+		b2.push_front(slotFrame[victim]);
+		ghosts[slotFrame[victim]] = { B2, b2.begin() };
+	}
+	else
+	{
+		return std::nullopt;
+	}
+
+	location[victim] = NONE;
+	trimGhosts();
+
+	return victim;
+}
+
+std::string ReplacementPolicy_ARC::getName() const
+{
+	return "ARC";
+}
+
+void ReplacementPolicy_ARC::remove(size_t slot)
+{
+	forget(slot);
+}
+
+void ReplacementPolicy_ARC::touch(size_t slot)
+{
+	if (location[slot] == T1)
+	{
+		t2.splice(t2.begin(), t1, position[slot]);
+		location[slot] = T2;
+	}
+	else if (location[slot] == T2)
+	{
+		t2.splice(t2.begin(), t2, position[slot]);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy.hpp"
+#include <list>
+#include <unordered_map>
+
+// ----- << Class >> ----- //
+
+/**
+ * @brief	Derived class for Adaptive Replacement Cache replacement
+ * 
+ *			Resident slots are split between T1 (seen once) and
+ *			T2 (seen again). Frame IDs evicted from each list are
+ *			remembered in the ghost lists B1 and B2, and a fault on
+ *			a ghost shifts the target size of T1 toward the list
+ *			that would have kept it
+ */
+class ReplacementPolicy_ARC : public ReplacementPolicy
+{
+private:
+	enum LIST_LOCATION
+	{
+		NONE,
+		T1,
+		T2,
+		B1,
+		B2
+	};
+
+	// Primitive Data Members
+	size_t target;
+			// Target number of slots in T1
+
+	// User-defined Data Members
+	std::list<size_t> t1;
+	std::list<size_t> t2;
+			// Resident slots, front is most recent
+
+	std::list<unsigned long long> b1;
+	std::list<unsigned long long> b2;
+			// Ghost frame IDs, front is most recent
+
+	std::vector<LIST_LOCATION> location;
+	std::vector<std::list<size_t>::iterator> position;
+	std::vector<unsigned long long> slotFrame;
+			// Per-slot list membership and resident frame ID
+
+	std::unordered_map<unsigned long long, 
+		std::pair<LIST_LOCATION, std::list<unsigned long long>::iterator>> ghosts;
+			// Frame ID, (B1 or B2, Position in the ghost list)
+
+	/**
+	 * @brief	Takes a slot out of T1 or T2 without remembering it
+	 * 
+	 * @param	slot --
+	 *			The index of the slot in physical memory
+	 */
+	void forget(size_t slot);
+
+	/**
+	 * @brief	Drops the oldest ghosts so B1 and B2 stay within
+	 *			the bounds of the algorithm
+	 */
+	void trimGhosts();
+
+public:
+	/**
+	 * @brief	Class constructor
+	 */
+	ReplacementPolicy_ARC(size_t numFrames);
+
+	/**
+	 * @brief	Places the slot in T1, or in T2 and adapts the
+	 *			target if the frame ID was a ghost
+	 */
+	void admit(size_t slot, unsigned long long frameID) override;
+
+	/**
+	 * @brief	Evicts the tail of T1 or T2 depending on the target
+	 *			and remembers its frame ID as a ghost
+	 */
+	std::optional<size_t> evict() override;
+
+	/**
+	 * @brief	Get the name of the policy
+	 */
+	std::string getName() const override;
+
+	/**
+	 * @brief	Stops tracking the slot
+	 */
+	void remove(size_t slot) override;
+
+	/**
+	 * @brief	Moves the slot to the head of T2
+	 */
+	void touch(size_t slot) override;
+};
\ No newline at end of file
@@ -0,0 +1,58 @@
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy_CLOCK.hpp"
+
+// ----- << Public Member Function Implementation >> ----- //
+ReplacementPolicy_CLOCK::ReplacementPolicy_CLOCK(size_t numFrames)
+	: ReplacementPolicy(numFrames), hand(0),
+	referenceBits(numFrames, 0), resident(numFrames, 0)
+{
+
+}
+
+void ReplacementPolicy_CLOCK::admit(size_t slot, unsigned long long)
+{
+	resident[slot] = 1;
+	referenceBits[slot] = 1;
+}
+
+std::optional<size_t> ReplacementPolicy_CLOCK::evict()
+{
+	// Two full sweeps are enough: the first clears every bit
+	for (size_t step = 0; step < numFrames * 2; step++)
+	{
+		size_t candidate = hand;
+		hand = (hand + 1) % numFrames;
+
+		if (!resident[candidate])
+		{
+			continue;
+		}
+
+		if (referenceBits[candidate])
+		{
+			referenceBits[candidate] = 0;
+			continue;
+		}
+
+		resident[candidate] = 0;
+		return candidate;
+	}
+
+	return std::nullopt;
+}
+
+std::string ReplacementPolicy_CLOCK::getName() const
+{
+	return "CLOCK";
+}
+
+void ReplacementPolicy_CLOCK::remove(size_t slot)
+{
+	resident[slot] = 0;
+	referenceBits[slot] = 0;
+}
+
+void ReplacementPolicy_CLOCK::touch(size_t slot)
+{
+	referenceBits[slot] = 1;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy.hpp"
+
+// ----- << Class >> ----- //
+
+/**
+ * @brief	Derived class for CLOCK (second-chance) replacement
+ * 
+ *			An access only sets the slot's reference bit. Eviction
+ *			sweeps a hand over the resident slots, clearing set bits
+ *			until it reaches one that is already clear
+ */
+class ReplacementPolicy_CLOCK : public ReplacementPolicy
+{
+private:
+	// Primitive Data Members
+	size_t hand;
+
+	// User-defined Data Members
+	std::vector<uint8_t> referenceBits;
+	std::vector<uint8_t> resident;
+
+public:
+	/**
+	 * @brief	Class constructor
+	 */
+	ReplacementPolicy_CLOCK(size_t numFrames);
+
+	/**
+	 * @brief	Marks the slot resident and referenced
+	 */
+	void admit(size_t slot, unsigned long long frameID) override;
+
+	/**
+	 * @brief	Sweeps the hand until an unreferenced resident slot
+	 *			is found
+	 */
+	std::optional<size_t> evict() override;
+
+	/**
+	 * @brief	Get the name of the policy
+	 */
+	std::string getName() const override;
+
+	/**
+	 * @brief	Marks the slot as not resident
+	 */
+	void remove(size_t slot) override;
+
+	/**
+	 * @brief	Sets the reference bit of the slot
+	 */
+	void touch(size_t slot) override;
+};
\ No newline at end of file
@@ -0,0 +1,19 @@
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy_FIFO.hpp"
+
+// ----- << Public Member Function Implementation >> ----- //
+ReplacementPolicy_FIFO::ReplacementPolicy_FIFO(size_t numFrames)
+	: ReplacementPolicy_LRU(numFrames)
+{
+
+}
+
+std::string ReplacementPolicy_FIFO::getName() const
+{
+	return "FIFO";
+}
+
+void ReplacementPolicy_FIFO::touch(size_t)
+{
+
+}
\ No newline at end of file
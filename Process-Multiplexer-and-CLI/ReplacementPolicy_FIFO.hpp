@@ -0,0 +1,31 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy_LRU.hpp"
+
+// ----- << Class >> ----- //
+
+/**
+ * @brief	Derived class for first-in first-out replacement
+ * 
+ *			Uses the LRU usage list but never reorders it on access,
+ *			so the tail is always the oldest loaded slot
+ */
+class ReplacementPolicy_FIFO : public ReplacementPolicy_LRU
+{
+public:
+	/**
+	 * @brief	Class constructor
+	 */
+	ReplacementPolicy_FIFO(size_t numFrames);
+
+	/**
+	 * @brief	Get the name of the policy
+	 */
+	std::string getName() const override;
+
+	/**
+	 * @brief	Does nothing, load order alone decides the victim
+	 */
+	void touch(size_t slot) override;
+};
\ No newline at end of file
@@ -0,0 +1,70 @@
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy_LFU.hpp"
+
+// ----- << Private Member Function Implementation >> ----- //
+void ReplacementPolicy_LFU::forget(size_t slot)
+{
+	if (resident[slot])
+	{
+		ordered.erase({ counts[slot], lastAccess[slot], slot });
+		resident[slot] = 0;
+	}
+}
+
+// ----- << Public Member Function Implementation >> ----- //
+ReplacementPolicy_LFU::ReplacementPolicy_LFU(size_t numFrames)
+	: ReplacementPolicy(numFrames), accessClock(0),
+	counts(numFrames, 0), lastAccess(numFrames, 0), resident(numFrames, 0)
+{
+
+}
+
+void ReplacementPolicy_LFU::admit(size_t slot, unsigned long long)
+{
+	forget(slot);
+
+	counts[slot] = 1;
+	lastAccess[slot] = ++accessClock;
+	resident[slot] = 1;
+
+	ordered.insert({ counts[slot], lastAccess[slot], slot });
+}
+
+std::optional<size_t> ReplacementPolicy_LFU::evict()
+{
+	if (ordered.empty())
+	{
+		return std::nullopt;
+	}
+
+	size_t victim = std::get<2>(*ordered.begin());
+	forget(victim);
+
+	return victim;
+}
+
+std::string ReplacementPolicy_LFU::getName() const
+{
+	return "LFU";
+}
+
+void ReplacementPolicy_LFU::remove(size_t slot)
+{
+	forget(slot);
+}
+
+void ReplacementPolicy_LFU::touch(size_t slot)
+{
+	if (!resident[slot])
+	{
+		return;
+	}
+
+	auto node = ordered.extract({ counts[slot], lastAccess[slot], slot });
+
+	counts[slot]++;
+	lastAccess[slot] = ++accessClock;
+
+	node.value() = { counts[slot], lastAccess[slot], slot };
+	ordered.insert(std::move(node));
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy.hpp"
+#include <set>
+#include <tuple>
+
+// ----- << Class >> ----- //
+
+/**
+ * @brief	Derived class for least frequently used replacement
+ * 
+ *			Resident slots are ordered by access count, ties are
+ *			broken by the least recent access. Touch and evict are
+ *			O(log numFrames)
+ */
+class ReplacementPolicy_LFU : public ReplacementPolicy
+{
+private:
+	// Primitive Data Members
+	uint64_t accessClock;
+
+	// User-defined Data Members
+	std::set<std::tuple<uint64_t, uint64_t, size_t>> ordered;
+			// (Access count, Last access, Slot), lowest is the victim
+
+	std::vector<uint64_t> counts;
+	std::vector<uint64_t> lastAccess;
+	std::vector<uint8_t> resident;
+
+	/**
+	 * @brief	Takes a slot out of the ordering
+	 * 
+	 * @param	slot --
+	 *			The index of the slot in physical memory
+	 */
+	void forget(size_t slot);
+
+public:
+	/**
+	 * @brief	Class constructor
+	 */
+	ReplacementPolicy_LFU(size_t numFrames);
+
+	/**
+	 * @brief	Starts tracking the slot with an access count of one
+	 */
+	void admit(size_t slot, unsigned long long frameID) override;
+
+	/**
+	 * @brief	Returns the resident slot with the lowest count
+	 */
+	std::optional<size_t> evict() override;
+
+	/**
+	 * @brief	Get the name of the policy
+	 */
+	std::string getName() const override;
+
+	/**
+	 * @brief	Stops tracking the slot
+	 */
+	void remove(size_t slot) override;
+
+	/**
+	 * @brief	Increments the access count of the slot
+	 */
+	void touch(size_t slot) override;
+};
\ No newline at end of file
@@ -0,0 +1,99 @@
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy_LRU.hpp"
+
+// ----- << Protected Member Function Implementation >> ----- //
+void ReplacementPolicy_LRU::linkFront(size_t slot)
+{
+	unlink(slot);
+
+	prev[slot] = noSlot;
+	next[slot] = head;
+
+	if (head != noSlot)
+	{
+		prev[head] = slot;
+	}
+	else
+	{
+		tail = slot;
+	}
+
+	head = slot;
+}
+
+void ReplacementPolicy_LRU::unlink(size_t slot)
+{
+	if (prev[slot] == noSlot && head != slot)
+	{
+		return;
+	}
+
+	if (prev[slot] != noSlot)
+	{
+		next[prev[slot]] = next[slot];
+	}
+	else
+	{
+		head = next[slot];
+	}
+
+	if (next[slot] != noSlot)
+	{
+		prev[next[slot]] = prev[slot];
+	}
+	else
+	{
+		tail = prev[slot];
+	}
+
+	prev[slot] = noSlot;
+	next[slot] = noSlot;
+}
+
+// ----- << Public Member Function Implementation >> ----- //
+ReplacementPolicy_LRU::ReplacementPolicy_LRU(size_t numFrames)
+	: ReplacementPolicy(numFrames), head(noSlot), tail(noSlot),
+	next(numFrames, noSlot), prev(numFrames, noSlot)
+{
+
+}
+
+void ReplacementPolicy_LRU::admit(size_t slot, unsigned long long)
+{
+	linkFront(slot);
+}
+
+std::optional<size_t> ReplacementPolicy_LRU::evict()
+{
+	if (tail == noSlot)
+	{
+		return std::nullopt;
+	}
+
+	size_t victim = tail;
+	unlink(victim);
+
+	return victim;
+}
+
+std::string ReplacementPolicy_LRU::getName() const
+{
+	return "LRU";
+}
+
+void ReplacementPolicy_LRU::remove(size_t slot)
+{
+	unlink(slot);
+}
+
+void ReplacementPolicy_LRU::touch(size_t slot)
+{
+	// Only the head has no predecessor, so this skips both the head
+	// and slots that are not linked
+	if (prev[slot] == noSlot)
+	{
+		return;
+	}
+
+	linkFront(slot);
+}
\ No newline at end of file
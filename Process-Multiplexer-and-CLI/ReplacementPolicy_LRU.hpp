@@ -0,0 +1,77 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include "ReplacementPolicy.hpp"
+
+// ----- << Class >> ----- //
+
+/**
+ * @brief	Derived class for exact least recently used replacement
+ * 
+ *			Recency is kept in a doubly-linked list threaded through
+ *			per-slot index arrays, so every hook is O(1) and never
+ *			allocates
+ */
+class ReplacementPolicy_LRU : public ReplacementPolicy
+{
+protected:
+	// Primitive Data Members
+	size_t head;
+	size_t tail;
+
+	static constexpr size_t noSlot = SIZE_MAX;
+
+	// User-defined Data Members
+	std::vector<size_t> next;
+	std::vector<size_t> prev;
+			// Usage list over slot indices, head is most recent
+
+	/**
+	 * @brief	Move a slot to the head of the usage list, linking
+	 *			it if it is not in the list
+	 * 
+	 * @param	slot --
+	 *			The index of the slot in physical memory
+	 */
+	void linkFront(size_t slot);
+
+	/**
+	 * @brief	Take a slot out of the usage list, does nothing if
+	 *			the slot is not in the list
+	 * 
+	 * @param	slot --
+	 *			The index of the slot in physical memory
+	 */
+	void unlink(size_t slot);
+
+public:
+	/**
+	 * @brief	Class constructor
+	 */
+	ReplacementPolicy_LRU(size_t numFrames);
+
+	/**
+	 * @brief	Links the slot as the most recently used
+	 */
+	void admit(size_t slot, unsigned long long frameID) override;
+
+	/**
+	 * @brief	Unlinks and returns the least recently used slot
+	 */
+	std::optional<size_t> evict() override;
+
+	/**
+	 * @brief	Get the name of the policy
+	 */
+	std::string getName() const override;
+
+	/**
+	 * @brief	Unlinks the slot
+	 */
+	void remove(size_t slot) override;
+
+	/**
+	 * @brief	Moves the slot to the head of the usage list
+	 */
+	void touch(size_t slot) override;
+};
\ No newline at end of file
@@ -0,0 +1,66 @@
+// ----- << External Library >> ----- //
+#include "TLB.hpp"
+#include <algorithm>
+#include <bit>
+
+// ----- << Private Member Function Implementation >> ----- //
+TLB::Entry& TLB::entryFor(unsigned long long processID, size_t pageIndex)
+{
+	// Spread the processes so their page 0 entries do not collide
+	size_t hash = pageIndex ^ static_cast<size_t>(processID * 0x9E3779B97F4A7C15ULL);
+
+	return entries[hash & mask];
+}
+
+// ----- << Public Member Function Implementation >> ----- //
+TLB::TLB(size_t numEntries)
+	: hits(0), misses(0)
+{
+	numEntries = std::bit_ceil(std::max<size_t>(1, numEntries));
+
+	entries = std::vector<Entry>(numEntries);
+	mask = numEntries - 1;
+}
+
+TLB::~TLB() = default;
+
+void TLB::clear()
+{
+	for (Entry& entry : entries)
+	{
+		entry.valid = false;
+		entry.table.reset();
+	}
+}
+
+size_t TLB::getHits() const
+{
+	return hits;
+}
+
+size_t TLB::getMisses() const
+{
+	return misses;
+}
+
+void TLB::insert(const Entry& entry)
+{
+	Entry& target = entryFor(entry.processID, entry.pageIndex);
+
+	target = entry;
+	target.valid = true;
+}
+
+std::optional<TLB::Entry> TLB::lookup(unsigned long long processID, size_t pageIndex)
+{
+	const Entry& entry = entryFor(processID, pageIndex);
+
+	if (entry.valid && entry.processID == processID && entry.pageIndex == pageIndex && entry.epoch == entry.table->shootdownEpoch)
+	{
+		hits++;
+		return entry;
+	}
+
+	misses++;
+	return std::nullopt;
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+// ----- << External Library >> ----- //
+#include "MMU.hpp"
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+// ----- << Class >> ----- //
+/**
+ * @brief	A small direct-mapped translation lookaside buffer that
+ *			caches (process ID, page index) -> physical memory slot
+ * 
+ *			Each Core owns one, so it is only used by the scheduler
+ *			thread of that Core. Entries are tagged with the process
+ *			ID, so a context switch does not need a flush
+ * 
+ *			An entry is only valid while its epoch equals the 
+ *			shootdown epoch of its page table, which the MMU 
+ *			advances whenever a page of that process is unmapped
+ */
+class TLB
+{
+public:
+	/**
+	 * @brief	A cached translation
+	 */
+	struct Entry
+	{
+		bool valid = false;
+		unsigned long long epoch = 0;
+		unsigned long long processID = 0;
+		size_t pageIndex = 0;
+		size_t slot = 0;
+				// Index of the frame in physical memory
+		std::shared_ptr<MMU::PageTable> table;
+				// Locked to check the page and count the reference
+				// on a hit
+	};
+
+private:
+	// Primitive Data Members
+	size_t mask;
+
+	std::atomic<size_t> hits;
+	std::atomic<size_t> misses;
+
+	// User-defined Data Members
+	std::vector<Entry> entries;
+
+	/**
+	 * @brief	Get the entry that a page maps to
+	 */
+	Entry& entryFor(unsigned long long processID, size_t pageIndex);
+
+public:
+	/**
+	 * @brief	Class constructor
+	 * 
+	 * @param	numEntries --
+	 *			Number of entries, rounded up to a power of two
+	 */
+	TLB(size_t numEntries);
+
+	/**
+	 * @brief	Class destructor
+	 */
+	~TLB();
+
+	/**
+	 * @brief	Invalidates every entry
+	 */
+	void clear();
+
+	/**
+	 * @brief	Get the number of lookups that were hits
+	 */
+	size_t getHits() const;
+
+	/**
+	 * @brief	Get the number of lookups that were misses
+	 */
+	size_t getMisses() const;
+
+	/**
+	 * @brief	Caches a translation, replacing whatever entry the
+	 *			page maps to
+	 * 
+	 * @param	entry --
+	 *			The translation being cached
+	 */
+	void insert(const Entry& entry);
+
+	/**
+	 * @brief	Looks up the translation of a page and counts the
+	 *			lookup as a hit or a miss
+	 * 
+	 * @param	processID --
+	 *			The process that owns the page
+	 * 
+	 * @param	pageIndex --
+	 *			The index of the page in the page table
+	 * 
+	 * @return	The cached translation. null if it is not cached or
+	 *			was cached before the last shootdown of its page 
+	 *			table
+	 */
+	std::optional<Entry> lookup(
+		unsigned long long processID,
+		size_t pageIndex
+	);
+};
\ No newline at end of file
@@ -2,7 +2,11 @@
 #include "TextSection.hpp"
 
 // ----- << Implementation >> ----- //
-TextSection::TextSection() = default;
+TextSection::TextSection()
+	: instructions(std::make_shared<std::vector<std::unique_ptr<Instruction>>>())
+{
+
+}
 
 TextSection::TextSection(TextSection&& source) noexcept
 	: instructions(std::move(source.instructions))
@@ -22,17 +26,25 @@ TextSection& TextSection::operator=(TextSection&& source) noexcept
 
 TextSection::~TextSection() = default;
 
+TextSection TextSection::share() const
+{
+	TextSection shared;
+	shared.instructions = instructions;
+
+	return shared;
+}
+
 void TextSection::addInstruction(std::unique_ptr<Instruction> instruction)
 {
-	instructions.push_back(std::move(instruction));
+	instructions->push_back(std::move(instruction));
 }
 
 const std::unique_ptr<Instruction>& TextSection::getInstruction(size_t index) const
 {
-	return instructions.at(index);
+	return instructions->at(index);
 }
 
 const std::vector<std::unique_ptr<Instruction>>& TextSection::getInstructionAll() const
 {
-	return instructions;
+	return *instructions;
 }
\ No newline at end of file
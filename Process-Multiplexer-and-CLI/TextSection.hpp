@@ -2,6 +2,7 @@
 
 // ----- << External Library >> ----- // 
 #include "Instruction.hpp"
+#include <memory>
 #include <vector>
 
 // ----- << Class >> ----- //
@@ -19,7 +20,9 @@ private:
 	// Primitive Data Members
 
 	// Object Members
-	std::vector<std::unique_ptr<Instruction>> instructions;
+	std::shared_ptr<std::vector<std::unique_ptr<Instruction>>> instructions;
+			// Shared by the text sections of forked processes,
+			// which only read it
 public:
 	/**
 	 * @brief	Class constructor
@@ -51,6 +54,14 @@ public:
 	 */
 	~TextSection();
 
+	/**
+	 * @brief	Creates a text section that uses the same 
+	 *			instructions, without copying them
+	 * 
+	 * @return	The shared text section
+	 */
+	TextSection share() const;
+
 	/**
 	 * @brief	Add an instruction to the text section
 	 * 
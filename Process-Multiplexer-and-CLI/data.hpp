@@ -28,6 +28,13 @@ struct CONFIGURATION
 	size_t maximumOverallMemory = 6;
 	size_t memoryPerFrame = 6;
 	size_t minimumMemoryPerProcess = 6;
+	size_t readAheadWindow = 0;
+	size_t compressedPoolSize = 0;
+	size_t hugePageSize = 0;
+	size_t reservedFramesPerProcess = 0;
+
+	std::string backingStoreMode = "FILE";
+	std::string pageReplacement = "LRU";
 };
 
 // ----- << Enumerations >> ----- //
@@ -76,6 +76,15 @@ static void _Screen_Commands(std::vector<std::string>& input, CPU& dev)
 {
 	if (input.size() == 2 && input.at(1) == "-ls")		dev.printProcessStatus();
 	else if (input.size() == 5 && input.at(1) == "-c")	dev.generateProcess(input.at(2), std::stoul(input.at(3)), input.at(4));
+	else if (input.size() == 4 && input.at(1) == "-f")
+	{
+		std::string sourceName = input.at(2);
+		std::string destinationName = input.at(3);
+
+		if (dev.forkProcess(sourceName, destinationName))	std::cout << "\n\nProcess [" + sourceName + "] forked as [" + destinationName + "]\n\n";
+		else if (dev.isProcessContained(destinationName))	std::cout << "\n\nProcess [" + destinationName + "] already exists\n\n";
+		else												std::cout << "\n\nProcess [" + sourceName + "] not found\n\n";
+	}
 	else if (input.size() == 3)
 	{
 		std::string processName = input.at(2);
@@ -155,6 +164,11 @@ static void systemInitialized()
 			else if (lineCommand == "vmstat")			MC.visualizeMemoryDetailed();
 			else if (lineCommand == "process-smi")		MC.visualizeMemorySummary();
 			else if (lineCommand == "report-util")		MC.writeReport();
+			else if (lineCommand == "backing-store-export")	MC.exportBackingStore();
+			else if (lineCommand == "benchmark-residency")	MC.benchmarkResidency();
+			else if (lineCommand == "benchmark-replacement")	MC.benchmarkReplacement();
+			else if (lineCommand == "benchmark-scaling")	MC.benchmarkScaling();
+			else if (lineCommand == "self-check")			MC.selfCheck();
 			else if (lineCommand == "exit")				isInitialized = false;
 			else
 			{
@@ -168,9 +182,16 @@ static void systemInitialized()
 }
 
 
-int main()
+int main(int argc, char* argv[])
 {
-	
+	// Lets scripts run the checks and test the exit code
+	if (argc > 1 && std::string(argv[1]) == "--self-check")
+	{
+		CPU MC;
+
+		return MC.selfCheck() ? 0 : 1;
+	}
+
 	bool isRunning = true;
 
 	std::string line;